@@ -1,5 +1,6 @@
 #include <mdk/files/seq/LegacyParser.hpp>
 #include <mdk/simul/Simulation.hpp>
+#include <mdk/simul/StaticSimulation.hpp>
 #include <mdk/files/param/LegacyParser.hpp>
 #include <mdk/system/LangPredictorCorrector.hpp>
 #include <mdk/forces/All.hpp>
@@ -29,7 +30,12 @@ int main() {
     rand.uniform();
     model.initVelocity(rand, 0.35 * eps_kB, false);
 
+#ifdef STATIC_SIMULATION
+    StaticSimulation<LangPredictorCorrector, Tether, BondAngles,
+        DihedralAngles, NativeContacts, PauliExclusion> simul(model, params);
+#else
     Simulation simul(model, params);
+#endif
 
     simul.add<Random>(rand);
     simul.add<LangPredictorCorrector>(0.005 * tau);
@@ -43,6 +49,12 @@ int main() {
     simul.add<NativeContacts>();
     simul.add<PauliExclusion>();
 
+#ifdef FUSED_BONDED
+    simul.add<FusedBonded<Tether, BondAngles, DihedralAngles>>(
+        simul.var<Tether>(), simul.var<BondAngles>(),
+        simul.var<DihedralAngles>());
+#endif
+
     // simul.add<PositionDiff>(model, "data/positions.txt", "posDiff.out");
     // for (int i = 0; i < 200; ++i) {
     // 	simul.step();
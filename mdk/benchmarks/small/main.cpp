@@ -1,4 +1,5 @@
 #include <mdk/simul/Simulation.hpp>
+#include <mdk/simul/StaticSimulation.hpp>
 #include <mdk/files/pdb/Parser.hpp>
 #include <mdk/files/param/LegacyParser.hpp>
 #include <mdk/hooks/PositionDiff.hpp>
@@ -9,6 +10,9 @@
 #include <mdk/forces/dihedral/ComplexNativeDihedral.hpp>
 #include <mdk/forces/go/NativeContacts.hpp>
 #include <mdk/forces/PauliExclusion.hpp>
+#include <mdk/forces/angle/BondAngles.hpp>
+#include <mdk/forces/dihedral/DihedralAngles.hpp>
+#include <mdk/forces/FusedBonded.hpp>
 #include <fstream>
 using namespace mdk;
 using namespace std;
@@ -29,7 +33,12 @@ int main() {
     model.legacyMorphIntoSAW(rand, false, 0, 4.56*angstrom, true);
     model.initVelocity(rand, 0.35 * eps_kB, false);
 
+#ifdef STATIC_SIMULATION
+    StaticSimulation<LangPredictorCorrector, Tether, BondAngles,
+        DihedralAngles, NativeContacts, PauliExclusion> simul(model, params);
+#else
     Simulation simul(model, params);
+#endif
 
     simul.add<Random>(rand);
     simul.add<LangPredictorCorrector>(0.005 * tau);
@@ -41,6 +50,12 @@ int main() {
     simul.add<NativeContacts>();
     simul.add<PauliExclusion>();
 
+#ifdef FUSED_BONDED
+    simul.add<FusedBonded<Tether, BondAngles, DihedralAngles>>(
+        simul.var<Tether>(), simul.var<BondAngles>(),
+        simul.var<DihedralAngles>());
+#endif
+
     for (int i = 0; i < 100'000; ++i) {
     	simul.step();
     }
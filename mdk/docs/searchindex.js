@@ -1 +0,0 @@
-Search.setIndex({docnames:["index","src/arch","src/entire","src/installation","src/prep/cmap","src/prep/index","src/prep/model","src/prep/param","src/prep/pdb/fields","src/prep/pdb/index","src/prep/pdb/model","src/prep/pdb/parsing","src/prep/pdb/raw","src/prep/pdb/recordparsers","src/prep/pdb/records","src/prep/seq","src/simul/data/factory","src/simul/data/index","src/simul/data/objects","src/simul/forces/bondangle","src/simul/forces/chiral","src/simul/forces/dihedral","src/simul/forces/es","src/simul/forces/gomodel","src/simul/forces/index","src/simul/forces/nonlocal","src/simul/forces/pauli","src/simul/forces/pid","src/simul/forces/qa","src/simul/forces/tether","src/simul/hooks/exportpdb","src/simul/hooks/index","src/simul/hooks/positiondiff","src/simul/hooks/progressbar","src/simul/index","src/simul/integrator/index","src/simul/integrator/langpc","src/simul/integrator/leapfrog","src/simul/kernels/harmonic","src/simul/kernels/index","src/simul/kernels/lj","src/simul/kernels/sidechainlj","src/simul/kernels/stlj","src/simul/primitives","src/simul/simulation","src/simul/simulvar","src/simul/state","src/simul/stats","src/simul/verlet","src/tutorial","src/utils/aminoacid","src/utils/contacttype","src/utils/index","src/utils/pairtype","src/utils/random","src/utils/restype","src/utils/topology","src/utils/units"],envversion:{"sphinx.domains.c":2,"sphinx.domains.changeset":1,"sphinx.domains.citation":1,"sphinx.domains.cpp":3,"sphinx.domains.index":1,"sphinx.domains.javascript":2,"sphinx.domains.math":2,"sphinx.domains.python":3,"sphinx.domains.rst":2,"sphinx.domains.std":2,sphinx:56},filenames:["index.rst","src/arch.rst","src/entire.rst","src/installation.rst","src/prep/cmap.rst","src/prep/index.rst","src/prep/model.rst","src/prep/param.rst","src/prep/pdb/fields.rst","src/prep/pdb/index.rst","src/prep/pdb/model.rst","src/prep/pdb/parsing.rst","src/prep/pdb/raw.rst","src/prep/pdb/recordparsers.rst","src/prep/pdb/records.rst","src/prep/seq.rst","src/simul/data/factory.rst","src/simul/data/index.rst","src/simul/data/objects.rst","src/simul/forces/bondangle.rst","src/simul/forces/chiral.rst","src/simul/forces/dihedral.rst","src/simul/forces/es.rst","src/simul/forces/gomodel.rst","src/simul/forces/index.rst","src/simul/forces/nonlocal.rst","src/simul/forces/pauli.rst","src/simul/forces/pid.rst","src/simul/forces/qa.rst","src/simul/forces/tether.rst","src/simul/hooks/exportpdb.rst","src/simul/hooks/index.rst","src/simul/hooks/positiondiff.rst","src/simul/hooks/progressbar.rst","src/simul/index.rst","src/simul/integrator/index.rst","src/simul/integrator/langpc.rst","src/simul/integrator/leapfrog.rst","src/simul/kernels/harmonic.rst","src/simul/kernels/index.rst","src/simul/kernels/lj.rst","src/simul/kernels/sidechainlj.rst","src/simul/kernels/stlj.rst","src/simul/primitives.rst","src/simul/simulation.rst","src/simul/simulvar.rst","src/simul/state.rst","src/simul/stats.rst","src/simul/verlet.rst","src/tutorial.rst","src/utils/aminoacid.rst","src/utils/contacttype.rst","src/utils/index.rst","src/utils/pairtype.rst","src/utils/random.rst","src/utils/restype.rst","src/utils/topology.rst","src/utils/units.rst"],objects:{"":{"mdk::AAAtomInfo":[50,2,1,"_CPPv4N3mdk10AAAtomInfoE"],"mdk::AAAtomInfo::inBackbone":[50,3,1,"_CPPv4N3mdk10AAAtomInfo10inBackboneE"],"mdk::AAAtomInfo::radius":[50,3,1,"_CPPv4N3mdk10AAAtomInfo6radiusE"],"mdk::ALA":[2,4,1,"_CPPv4N3mdk12AminoAcidIdx3ALAE"],"mdk::ARG":[2,4,1,"_CPPv4N3mdk12AminoAcidIdx3ARGE"],"mdk::ASN":[2,4,1,"_CPPv4N3mdk12AminoAcidIdx3ASNE"],"mdk::ASP":[2,4,1,"_CPPv4N3mdk12AminoAcidIdx3ASPE"],"mdk::AminoAcid":[50,2,1,"_CPPv4N3mdk9AminoAcidE"],"mdk::AminoAcid::AminoAcid":[50,5,1,"_CPPv4N3mdk9AminoAcid9AminoAcidEv"],"mdk::AminoAcid::AminoAcid::code":[50,6,1,"_CPPv4N3mdk9AminoAcid9AminoAcidEc"],"mdk::AminoAcid::AminoAcid::name":[50,6,1,"_CPPv4N3mdk9AminoAcid9AminoAcidERKNSt6stringE"],"mdk::AminoAcid::AminoAcid::type":[50,6,1,"_CPPv4N3mdk9AminoAcid9AminoAcidE12AminoAcidIdx"],"mdk::AminoAcid::AminoAcid::x":[50,6,1,"_CPPv4N3mdk9AminoAcid9AminoAcidE6int8_t"],"mdk::AminoAcid::N":[50,3,1,"_CPPv4N3mdk9AminoAcid1NE"],"mdk::AminoAcid::aminoAcids":[50,5,1,"_CPPv4N3mdk9AminoAcid10aminoAcidsEv"],"mdk::AminoAcid::codes":[50,5,1,"_CPPv4N3mdk9AminoAcid5codesEv"],"mdk::AminoAcid::info":[50,5,1,"_CPPv4NK3mdk9AminoAcid4infoEv"],"mdk::AminoAcid::isProper":[50,5,1,"_CPPv4N3mdk9AminoAcid8isProperERKNSt6stringE"],"mdk::AminoAcid::isProper::name":[50,6,1,"_CPPv4N3mdk9AminoAcid8isProperERKNSt6stringE"],"mdk::AminoAcid::names":[50,5,1,"_CPPv4N3mdk9AminoAcid5namesEv"],"mdk::AminoAcid::operator AminoAcidIdx const&amp;":[50,5,1,"_CPPv4NK3mdk9AminoAcidcvRK12AminoAcidIdxEv"],"mdk::AminoAcid::operator char const&amp;":[50,5,1,"_CPPv4NK3mdk9AminoAcidcvRKcEv"],"mdk::AminoAcid::operator int8_t":[50,5,1,"_CPPv4NK3mdk9AminoAcidcv6int8_tEv"],"mdk::AminoAcid::operator std::string":[50,5,1,"_CPPv4NK3mdk9AminoAcidcvNSt6stringEEv"],"mdk::AminoAcid::operator!=":[50,5,1,"_CPPv4NK3mdk9AminoAcidneERK9AminoAcid"],"mdk::AminoAcid::operator!=::other":[50,6,1,"_CPPv4NK3mdk9AminoAcidneERK9AminoAcid"],"mdk::AminoAcid::operator&gt;":[50,5,1,"_CPPv4NK3mdk9AminoAcidgtERK9AminoAcid"],"mdk::AminoAcid::operator&gt;::other":[50,6,1,"_CPPv4NK3mdk9AminoAcidgtERK9AminoAcid"],"mdk::AminoAcid::operator&gt;=":[50,5,1,"_CPPv4NK3mdk9AminoAcidgeERK9AminoAcid"],"mdk::AminoAcid::operator&gt;=::other":[50,6,1,"_CPPv4NK3mdk9AminoAcidgeERK9AminoAcid"],"mdk::AminoAcid::operator&lt;":[50,5,1,"_CPPv4NK3mdk9AminoAcidltERK9AminoAcid"],"mdk::AminoAcid::operator&lt;::other":[50,6,1,"_CPPv4NK3mdk9AminoAcidltERK9AminoAcid"],"mdk::AminoAcid::operator&lt;=":[50,5,1,"_CPPv4NK3mdk9AminoAcidleERK9AminoAcid"],"mdk::AminoAcid::operator&lt;=::other":[50,6,1,"_CPPv4NK3mdk9AminoAcidleERK9AminoAcid"],"mdk::AminoAcid::operator==":[50,5,1,"_CPPv4NK3mdk9AminoAcideqERK9AminoAcid"],"mdk::AminoAcid::operator==::other":[50,6,1,"_CPPv4NK3mdk9AminoAcideqERK9AminoAcid"],"mdk::AminoAcid::type":[50,3,1,"_CPPv4N3mdk9AminoAcid4typeE"],"mdk::AminoAcid::types":[50,5,1,"_CPPv4N3mdk9AminoAcid5typesEv"],"mdk::AminoAcidIdx":[50,7,1,"_CPPv4N3mdk12AminoAcidIdxE"],"mdk::AminoAcidIdx::ALA":[50,4,1,"_CPPv4N3mdk12AminoAcidIdx3ALAE"],"mdk::AminoAcidIdx::ARG":[50,4,1,"_CPPv4N3mdk12AminoAcidIdx3ARGE"],"mdk::AminoAcidIdx::ASN":[50,4,1,"_CPPv4N3mdk12AminoAcidIdx3ASNE"],"mdk::AminoAcidIdx::ASP":[50,4,1,"_CPPv4N3mdk12AminoAcidIdx3ASPE"],"mdk::AminoAcidIdx::CYS":[50,4,1,"_CPPv4N3mdk12AminoAcidIdx3CYSE"],"mdk::AminoAcidIdx::GLN":[50,4,1,"_CPPv4N3mdk12AminoAcidIdx3GLNE"],"mdk::AminoAcidIdx::GLU":[50,4,1,"_CPPv4N3mdk12AminoAcidIdx3GLUE"],"mdk::AminoAcidIdx::GLY":[50,4,1,"_CPPv4N3mdk12AminoAcidIdx3GLYE"],"mdk::AminoAcidIdx::HIS":[50,4,1,"_CPPv4N3mdk12AminoAcidIdx3HISE"],"mdk::AminoAcidIdx::ILE":[50,4,1,"_CPPv4N3mdk12AminoAcidIdx3ILEE"],"mdk::AminoAcidIdx::LEU":[50,4,1,"_CPPv4N3mdk12AminoAcidIdx3LEUE"],"mdk::AminoAcidIdx::LYS":[50,4,1,"_CPPv4N3mdk12AminoAcidIdx3LYSE"],"mdk::AminoAcidIdx::MET":[50,4,1,"_CPPv4N3mdk12AminoAcidIdx3METE"],"mdk::AminoAcidIdx::PHE":[50,4,1,"_CPPv4N3mdk12AminoAcidIdx3PHEE"],"mdk::AminoAcidIdx::PRO":[50,4,1,"_CPPv4N3mdk12AminoAcidIdx3PROE"],"mdk::AminoAcidIdx::SER":[50,4,1,"_CPPv4N3mdk12AminoAcidIdx3SERE"],"mdk::AminoAcidIdx::THR":[50,4,1,"_CPPv4N3mdk12AminoAcidIdx3THRE"],"mdk::AminoAcidIdx::TRP":[50,4,1,"_CPPv4N3mdk12AminoAcidIdx3TRPE"],"mdk::AminoAcidIdx::TYR":[50,4,1,"_CPPv4N3mdk12AminoAcidIdx3TYRE"],"mdk::AminoAcidIdx::VAL":[50,4,1,"_CPPv4N3mdk12AminoAcidIdx3VALE"],"mdk::AminoAcidInfo":[50,2,1,"_CPPv4N3mdk13AminoAcidInfoE"],"mdk::AminoAcidInfo::atomInfo":[50,3,1,"_CPPv4N3mdk13AminoAcidInfo8atomInfoE"],"mdk::AminoAcidInfo::heavyAtoms":[50,3,1,"_CPPv4N3mdk13AminoAcidInfo10heavyAtomsE"],"mdk::AminoAcidInfo::mass":[50,3,1,"_CPPv4N3mdk13AminoAcidInfo4massE"],"mdk::Ampere":[57,3,1,"_CPPv4N3mdk6AmpereE"],"mdk::BondAngles":[19,2,1,"_CPPv4N3mdk10BondAnglesE"],"mdk::BondAngles::asyncPart":[19,5,1,"_CPPv4N3mdk10BondAngles9asyncPartER8Dynamics"],"mdk::BondAngles::asyncPart::dynamics":[19,6,1,"_CPPv4N3mdk10BondAngles9asyncPartER8Dynamics"],"mdk::BondAngles::bind":[19,5,1,"_CPPv4N3mdk10BondAngles4bindER10Simulation"],"mdk::BondAngles::bind::simulation":[19,6,1,"_CPPv4N3mdk10BondAngles4bindER10Simulation"],"mdk::BondAngles::heurBA":[19,3,1,"_CPPv4N3mdk10BondAngles6heurBAE"],"mdk::BondAngles::inRange":[19,3,1,"_CPPv4N3mdk10BondAngles7inRangeE"],"mdk::BondAngles::natBA":[19,3,1,"_CPPv4N3mdk10BondAngles5natBAE"],"mdk::Bytes":[43,1,1,"_CPPv4N3mdk5BytesE"],"mdk::CYS":[2,4,1,"_CPPv4N3mdk12AminoAcidIdx3CYSE"],"mdk::Chains":[18,2,1,"_CPPv4N3mdk6ChainsE"],"mdk::Chains::Chains":[18,5,1,"_CPPv4N3mdk6Chains6ChainsEv"],"mdk::Chains::Chains::model":[18,6,1,"_CPPv4N3mdk6Chains6ChainsERK5Model"],"mdk::Chains::chainIdx":[18,3,1,"_CPPv4N3mdk6Chains8chainIdxE"],"mdk::Chains::isTerminal":[18,3,1,"_CPPv4N3mdk6Chains10isTerminalE"],"mdk::Chains::model":[18,3,1,"_CPPv4N3mdk6Chains5modelE"],"mdk::Chains::nativeQuads":[18,3,1,"_CPPv4N3mdk6Chains11nativeQuadsE"],"mdk::Chains::nativeTriples":[18,3,1,"_CPPv4N3mdk6Chains13nativeTriplesE"],"mdk::Chains::nativeTuples":[18,5,1,"_CPPv4NK3mdk6Chains12nativeTuplesEi"],"mdk::Chains::nativeTuples::k":[18,6,1,"_CPPv4NK3mdk6Chains12nativeTuplesEi"],"mdk::Chains::pairs":[18,3,1,"_CPPv4N3mdk6Chains5pairsE"],"mdk::Chains::quads":[18,3,1,"_CPPv4N3mdk6Chains5quadsE"],"mdk::Chains::sepByAtLeastN":[18,5,1,"_CPPv4NK3mdk6Chains13sepByAtLeastNEiii"],"mdk::Chains::sepByAtLeastN::i1":[18,6,1,"_CPPv4NK3mdk6Chains13sepByAtLeastNEiii"],"mdk::Chains::sepByAtLeastN::i2":[18,6,1,"_CPPv4NK3mdk6Chains13sepByAtLeastNEiii"],"mdk::Chains::sepByAtLeastN::n":[18,6,1,"_CPPv4NK3mdk6Chains13sepByAtLeastNEiii"],"mdk::Chains::triples":[18,3,1,"_CPPv4N3mdk6Chains7triplesE"],"mdk::Chains::tuples":[18,5,1,"_CPPv4NK3mdk6Chains6tuplesEi"],"mdk::Chains::tuples::k":[18,6,1,"_CPPv4NK3mdk6Chains6tuplesEi"],"mdk::Charges":[18,2,1,"_CPPv4N3mdk7ChargesE"],"mdk::Charges::Charges":[18,5,1,"_CPPv4N3mdk7Charges7ChargesEv"],"mdk::Charges::Charges::model":[18,6,1,"_CPPv4N3mdk7Charges7ChargesERK5ModelRKN5param10ParametersE"],"mdk::Charges::Charges::params":[18,6,1,"_CPPv4N3mdk7Charges7ChargesERK5ModelRKN5param10ParametersE"],"mdk::Chirality":[20,2,1,"_CPPv4N3mdk9ChiralityE"],"mdk::Chirality::C_nat":[20,3,1,"_CPPv4N3mdk9Chirality5C_natE"],"mdk::Chirality::asyncPart":[20,5,1,"_CPPv4N3mdk9Chirality9asyncPartER8Dynamics"],"mdk::Chirality::asyncPart::dynamics":[20,6,1,"_CPPv4N3mdk9Chirality9asyncPartER8Dynamics"],"mdk::Chirality::bind":[20,5,1,"_CPPv4N3mdk9Chirality4bindER10Simulation"],"mdk::Chirality::bind::simulation":[20,6,1,"_CPPv4N3mdk9Chirality4bindER10Simulation"],"mdk::Chirality::d0_cube_inv":[20,3,1,"_CPPv4N3mdk9Chirality11d0_cube_invE"],"mdk::Chirality::e_chi":[20,3,1,"_CPPv4N3mdk9Chirality5e_chiE"],"mdk::Chirality::inRange":[20,3,1,"_CPPv4N3mdk9Chirality7inRangeE"],"mdk::ComplexNativeDihedral":[21,2,1,"_CPPv4N3mdk21ComplexNativeDihedralE"],"mdk::ComplexNativeDihedral::CDA":[21,3,1,"_CPPv4N3mdk21ComplexNativeDihedral3CDAE"],"mdk::ComplexNativeDihedral::CDB":[21,3,1,"_CPPv4N3mdk21ComplexNativeDihedral3CDBE"],"mdk::ComplexNativeDihedral::bind":[21,5,1,"_CPPv4N3mdk21ComplexNativeDihedral4bindER10Simulation"],"mdk::ComplexNativeDihedral::bind::simulation":[21,6,1,"_CPPv4N3mdk21ComplexNativeDihedral4bindER10Simulation"],"mdk::ComplexNativeDihedral::term":[21,5,1,"_CPPv4NK3mdk21ComplexNativeDihedral4termEidRdRd"],"mdk::ComplexNativeDihedral::term::V":[21,6,1,"_CPPv4NK3mdk21ComplexNativeDihedral4termEidRdRd"],"mdk::ComplexNativeDihedral::term::dV_dphi":[21,6,1,"_CPPv4NK3mdk21ComplexNativeDihedral4termEidRdRd"],"mdk::ComplexNativeDihedral::term::i":[21,6,1,"_CPPv4NK3mdk21ComplexNativeDihedral4termEidRdRd"],"mdk::ComplexNativeDihedral::term::phi":[21,6,1,"_CPPv4NK3mdk21ComplexNativeDihedral4termEidRdRd"],"mdk::ConstDH":[22,2,1,"_CPPv4N3mdk7ConstDHE"],"mdk::ConstDH::asyncPart":[22,5,1,"_CPPv4N3mdk7ConstDH9asyncPartER8Dynamics"],"mdk::ConstDH::asyncPart::dynamics":[22,6,1,"_CPPv4N3mdk7ConstDH9asyncPartER8Dynamics"],"mdk::ConstDH::permittivity":[22,3,1,"_CPPv4N3mdk7ConstDH12permittivityE"],"mdk::ConstDH::screeningDist":[22,3,1,"_CPPv4N3mdk7ConstDH13screeningDistE"],"mdk::ConstDH::spec":[22,5,1,"_CPPv4NK3mdk7ConstDH4specEv"],"mdk::ContactType":[51,2,1,"_CPPv4N3mdk11ContactTypeE"],"mdk::ContactType::ContactType":[51,5,1,"_CPPv4N3mdk11ContactType11ContactTypeEv"],"mdk::ContactType::ContactType::code":[51,6,1,"_CPPv4N3mdk11ContactType11ContactTypeE14ContactTypeIdx"],"mdk::ContactType::ContactType::name":[51,6,1,"_CPPv4N3mdk11ContactType11ContactTypeERKNSt6stringE"],"mdk::ContactType::ContactType::x":[51,6,1,"_CPPv4N3mdk11ContactType11ContactTypeE6int8_t"],"mdk::ContactType::code":[51,3,1,"_CPPv4N3mdk11ContactType4codeE"],"mdk::ContactType::operator ContactTypeIdx const&amp;":[51,5,1,"_CPPv4NK3mdk11ContactTypecvRK14ContactTypeIdxEv"],"mdk::ContactType::operator int8_t":[51,5,1,"_CPPv4NK3mdk11ContactTypecv6int8_tEv"],"mdk::ContactType::operator std::string":[51,5,1,"_CPPv4NK3mdk11ContactTypecvNSt6stringEEv"],"mdk::ContactTypeIdx":[51,7,1,"_CPPv4N3mdk14ContactTypeIdxE"],"mdk::ContactTypeIdx::NAT":[51,4,1,"_CPPv4N3mdk14ContactTypeIdx3NATE"],"mdk::ContactTypeIdx::NAT_BB":[51,4,1,"_CPPv4N3mdk14ContactTypeIdx6NAT_BBE"],"mdk::ContactTypeIdx::NAT_BS":[51,4,1,"_CPPv4N3mdk14ContactTypeIdx6NAT_BSE"],"mdk::ContactTypeIdx::NAT_SB":[51,4,1,"_CPPv4N3mdk14ContactTypeIdx6NAT_SBE"],"mdk::ContactTypeIdx::NAT_SS":[51,4,1,"_CPPv4N3mdk14ContactTypeIdx6NAT_SSE"],"mdk::ContactTypeIdx::SSBOND":[51,4,1,"_CPPv4N3mdk14ContactTypeIdx6SSBONDE"],"mdk::Coulomb":[57,3,1,"_CPPv4N3mdk7CoulombE"],"mdk::DataFactory":[16,2,1,"_CPPv4N3mdk11DataFactoryE"],"mdk::DataFactory::DataFactory":[16,5,1,"_CPPv4N3mdk11DataFactory11DataFactoryERK5ModelRKN5param10ParametersE"],"mdk::DataFactory::DataFactory::model":[16,6,1,"_CPPv4N3mdk11DataFactory11DataFactoryERK5ModelRKN5param10ParametersE"],"mdk::DataFactory::DataFactory::params":[16,6,1,"_CPPv4N3mdk11DataFactory11DataFactoryERK5ModelRKN5param10ParametersE"],"mdk::DataFactory::create":[16,5,1,"_CPPv4IENK3mdk11DataFactory6createE7Chargesv"],"mdk::DataFactory::create::Data":[16,8,1,"_CPPv4I0ENK3mdk11DataFactory6createE4Datav"],"mdk::DataFactory::data":[16,5,1,"_CPPv4I0EN3mdk11DataFactory4dataERK4Datav"],"mdk::DataFactory::data::Data":[16,8,1,"_CPPv4I0EN3mdk11DataFactory4dataERK4Datav"],"mdk::DataFactory::model":[16,3,1,"_CPPv4N3mdk11DataFactory5modelE"],"mdk::DataFactory::params":[16,3,1,"_CPPv4N3mdk11DataFactory6paramsE"],"mdk::DataFactory::savedData":[16,3,1,"_CPPv4N3mdk11DataFactory9savedDataE"],"mdk::DihedralAngles":[21,2,1,"_CPPv4N3mdk14DihedralAnglesE"],"mdk::DihedralAngles::asyncPart":[21,5,1,"_CPPv4N3mdk14DihedralAngles9asyncPartER8Dynamics"],"mdk::DihedralAngles::asyncPart::dynamics":[21,6,1,"_CPPv4N3mdk14DihedralAngles9asyncPartER8Dynamics"],"mdk::DihedralAngles::bind":[21,5,1,"_CPPv4N3mdk14DihedralAngles4bindER10Simulation"],"mdk::DihedralAngles::bind::simulation":[21,6,1,"_CPPv4N3mdk14DihedralAngles4bindER10Simulation"],"mdk::DihedralAngles::heurDih":[21,3,1,"_CPPv4N3mdk14DihedralAngles7heurDihE"],"mdk::DihedralAngles::inRange":[21,3,1,"_CPPv4N3mdk14DihedralAngles7inRangeE"],"mdk::DihedralAngles::natDih":[21,3,1,"_CPPv4N3mdk14DihedralAngles6natDihE"],"mdk::Dynamics":[2,2,1,"_CPPv4N3mdk8DynamicsE"],"mdk::Dynamics::F":[2,3,1,"_CPPv4N3mdk8Dynamics1FE"],"mdk::Dynamics::V":[2,3,1,"_CPPv4N3mdk8Dynamics1VE"],"mdk::Dynamics::zero":[2,5,1,"_CPPv4N3mdk8Dynamics4zeroEi"],"mdk::Dynamics::zero::n":[2,6,1,"_CPPv4N3mdk8Dynamics4zeroEi"],"mdk::ESBase":[22,2,1,"_CPPv4N3mdk6ESBaseE"],"mdk::ESBase::Contact":[22,2,1,"_CPPv4N3mdk6ESBase7ContactE"],"mdk::ESBase::Contact::i1":[22,3,1,"_CPPv4N3mdk6ESBase7Contact2i1E"],"mdk::ESBase::Contact::i2":[22,3,1,"_CPPv4N3mdk6ESBase7Contact2i2E"],"mdk::ESBase::Contact::q1_x_q2":[22,3,1,"_CPPv4N3mdk6ESBase7Contact7q1_x_q2E"],"mdk::ESBase::bind":[22,5,1,"_CPPv4N3mdk6ESBase4bindER10Simulation"],"mdk::ESBase::bind::simulation":[22,6,1,"_CPPv4N3mdk6ESBase4bindER10Simulation"],"mdk::ESBase::charge":[22,3,1,"_CPPv4N3mdk6ESBase6chargeE"],"mdk::ESBase::pairs":[22,3,1,"_CPPv4N3mdk6ESBase5pairsE"],"mdk::ESBase::vlUpdateHook":[22,5,1,"_CPPv4N3mdk6ESBase12vlUpdateHookEv"],"mdk::ExportPDB":[30,2,1,"_CPPv4N3mdk9ExportPDBE"],"mdk::ExportPDB::ExportPDB":[30,5,1,"_CPPv4N3mdk9ExportPDB9ExportPDBENSt10filesystem4pathEd"],"mdk::ExportPDB::ExportPDB::modelPath":[30,6,1,"_CPPv4N3mdk9ExportPDB9ExportPDBENSt10filesystem4pathEd"],"mdk::ExportPDB::ExportPDB::period":[30,6,1,"_CPPv4N3mdk9ExportPDB9ExportPDBENSt10filesystem4pathEd"],"mdk::ExportPDB::base":[30,3,1,"_CPPv4N3mdk9ExportPDB4baseE"],"mdk::ExportPDB::bind":[30,5,1,"_CPPv4N3mdk9ExportPDB4bindER10Simulation"],"mdk::ExportPDB::bind::simulation":[30,6,1,"_CPPv4N3mdk9ExportPDB4bindER10Simulation"],"mdk::ExportPDB::data":[30,3,1,"_CPPv4N3mdk9ExportPDB4dataE"],"mdk::ExportPDB::execute":[30,5,1,"_CPPv4N3mdk9ExportPDB7executeEi"],"mdk::ExportPDB::execute::step_nr":[30,6,1,"_CPPv4N3mdk9ExportPDB7executeEi"],"mdk::ExportPDB::modelIdx":[30,3,1,"_CPPv4N3mdk9ExportPDB8modelIdxE"],"mdk::ExportPDB::modelPath":[30,3,1,"_CPPv4N3mdk9ExportPDB9modelPathE"],"mdk::ExportPDB::period":[30,3,1,"_CPPv4N3mdk9ExportPDB6periodE"],"mdk::ExportPDB::state":[30,3,1,"_CPPv4N3mdk9ExportPDB5stateE"],"mdk::ExportPDB::tprev":[30,3,1,"_CPPv4N3mdk9ExportPDB5tprevE"],"mdk::ExportPDB::~ExportPDB":[30,5,1,"_CPPv4N3mdk9ExportPDBD0Ev"],"mdk::Force":[24,2,1,"_CPPv4N3mdk5ForceE"],"mdk::Force::asyncPart":[24,5,1,"_CPPv4N3mdk5Force9asyncPartER8Dynamics"],"mdk::Force::asyncPart::dynamics":[24,6,1,"_CPPv4N3mdk5Force9asyncPartER8Dynamics"],"mdk::Force::bind":[24,5,1,"_CPPv4N3mdk5Force4bindER10Simulation"],"mdk::Force::bind::simulation":[24,6,1,"_CPPv4N3mdk5Force4bindER10Simulation"],"mdk::Force::state":[24,3,1,"_CPPv4N3mdk5Force5stateE"],"mdk::Force::syncPart":[24,5,1,"_CPPv4N3mdk5Force8syncPartER8Dynamics"],"mdk::Force::syncPart::dynamics":[24,6,1,"_CPPv4N3mdk5Force8syncPartER8Dynamics"],"mdk::GG":[2,4,1,"_CPPv4N3mdk8PairType2GGE"],"mdk::GLN":[2,4,1,"_CPPv4N3mdk12AminoAcidIdx3GLNE"],"mdk::GLU":[2,4,1,"_CPPv4N3mdk12AminoAcidIdx3GLUE"],"mdk::GLY":[2,4,1,"_CPPv4N3mdk12AminoAcidIdx3GLYE"],"mdk::GP":[2,4,1,"_CPPv4N3mdk8PairType2GPE"],"mdk::GX":[2,4,1,"_CPPv4N3mdk8PairType2GXE"],"mdk::HIS":[2,4,1,"_CPPv4N3mdk12AminoAcidIdx3HISE"],"mdk::Harmonic":[38,2,1,"_CPPv4N3mdk8HarmonicE"],"mdk::Harmonic::H1":[38,3,1,"_CPPv4N3mdk8Harmonic2H1E"],"mdk::Harmonic::H2":[38,3,1,"_CPPv4N3mdk8Harmonic2H2E"],"mdk::Harmonic::Harmonic":[38,5,1,"_CPPv4N3mdk8Harmonic8HarmonicEv"],"mdk::Harmonic::Harmonic::H1":[38,6,1,"_CPPv4N3mdk8Harmonic8HarmonicEdd"],"mdk::Harmonic::Harmonic::H2":[38,6,1,"_CPPv4N3mdk8Harmonic8HarmonicEdd"],"mdk::Harmonic::computeF":[38,5,1,"_CPPv4I00ENK3mdk8Harmonic8computeFEv4VRefdRd2T12T2"],"mdk::Harmonic::computeF::F1":[38,6,1,"_CPPv4I00ENK3mdk8Harmonic8computeFEv4VRefdRd2T12T2"],"mdk::Harmonic::computeF::F2":[38,6,1,"_CPPv4I00ENK3mdk8Harmonic8computeFEv4VRefdRd2T12T2"],"mdk::Harmonic::computeF::T1":[38,8,1,"_CPPv4I00ENK3mdk8Harmonic8computeFEv4VRefdRd2T12T2"],"mdk::Harmonic::computeF::T2":[38,8,1,"_CPPv4I00ENK3mdk8Harmonic8computeFEv4VRefdRd2T12T2"],"mdk::Harmonic::computeF::V":[38,6,1,"_CPPv4I00ENK3mdk8Harmonic8computeFEv4VRefdRd2T12T2"],"mdk::Harmonic::computeF::dx":[38,6,1,"_CPPv4I00ENK3mdk8Harmonic8computeFEv4VRefdRd2T12T2"],"mdk::Harmonic::computeF::unit":[38,6,1,"_CPPv4I00ENK3mdk8Harmonic8computeFEv4VRefdRd2T12T2"],"mdk::Harmonic::computeV":[38,5,1,"_CPPv4NK3mdk8Harmonic8computeVEdRdRd"],"mdk::Harmonic::computeV::V":[38,6,1,"_CPPv4NK3mdk8Harmonic8computeVEdRdRd"],"mdk::Harmonic::computeV::dV_dx":[38,6,1,"_CPPv4NK3mdk8Harmonic8computeVEdRdRd"],"mdk::Harmonic::computeV::dx":[38,6,1,"_CPPv4NK3mdk8Harmonic8computeVEdRdRd"],"mdk::Henry":[57,3,1,"_CPPv4N3mdk5HenryE"],"mdk::HeuresticBA":[19,2,1,"_CPPv4N3mdk11HeuresticBAE"],"mdk::HeuresticBA::D":[19,3,1,"_CPPv4N3mdk11HeuresticBA1DE"],"mdk::HeuresticBA::angleTypes":[19,3,1,"_CPPv4N3mdk11HeuresticBA10angleTypesE"],"mdk::HeuresticBA::bind":[19,5,1,"_CPPv4N3mdk11HeuresticBA4bindER10Simulation"],"mdk::HeuresticBA::bind::simulation":[19,6,1,"_CPPv4N3mdk11HeuresticBA4bindER10Simulation"],"mdk::HeuresticBA::coeff":[19,3,1,"_CPPv4N3mdk11HeuresticBA5coeffE"],"mdk::HeuresticBA::term":[19,5,1,"_CPPv4NK3mdk11HeuresticBA4termEidRdRd"],"mdk::HeuresticBA::term::V":[19,6,1,"_CPPv4NK3mdk11HeuresticBA4termEidRdRd"],"mdk::HeuresticBA::term::dV_dth":[19,6,1,"_CPPv4NK3mdk11HeuresticBA4termEidRdRd"],"mdk::HeuresticBA::term::i":[19,6,1,"_CPPv4NK3mdk11HeuresticBA4termEidRdRd"],"mdk::HeuresticBA::term::theta":[19,6,1,"_CPPv4NK3mdk11HeuresticBA4termEidRdRd"],"mdk::HeuresticDihedral":[21,2,1,"_CPPv4N3mdk17HeuresticDihedralE"],"mdk::HeuresticDihedral::angleTypes":[21,3,1,"_CPPv4N3mdk17HeuresticDihedral10angleTypesE"],"mdk::HeuresticDihedral::bind":[21,5,1,"_CPPv4N3mdk17HeuresticDihedral4bindER10Simulation"],"mdk::HeuresticDihedral::bind::simulation":[21,6,1,"_CPPv4N3mdk17HeuresticDihedral4bindER10Simulation"],"mdk::HeuresticDihedral::coeff":[21,3,1,"_CPPv4N3mdk17HeuresticDihedral5coeffE"],"mdk::HeuresticDihedral::term":[21,5,1,"_CPPv4NK3mdk17HeuresticDihedral4termEidRdRd"],"mdk::HeuresticDihedral::term::V":[21,6,1,"_CPPv4NK3mdk17HeuresticDihedral4termEidRdRd"],"mdk::HeuresticDihedral::term::dV_dphi":[21,6,1,"_CPPv4NK3mdk17HeuresticDihedral4termEidRdRd"],"mdk::HeuresticDihedral::term::i":[21,6,1,"_CPPv4NK3mdk17HeuresticDihedral4termEidRdRd"],"mdk::HeuresticDihedral::term::phi":[21,6,1,"_CPPv4NK3mdk17HeuresticDihedral4termEidRdRd"],"mdk::Hook":[31,2,1,"_CPPv4N3mdk4HookE"],"mdk::Hook::execute":[31,5,1,"_CPPv4N3mdk4Hook7executeEi"],"mdk::Hook::execute::step_nr":[31,6,1,"_CPPv4N3mdk4Hook7executeEi"],"mdk::ILE":[2,4,1,"_CPPv4N3mdk12AminoAcidIdx3ILEE"],"mdk::Integers":[43,1,1,"_CPPv4N3mdk8IntegersE"],"mdk::Integrator":[35,2,1,"_CPPv4N3mdk10IntegratorE"],"mdk::Integrator::bind":[35,5,1,"_CPPv4N3mdk10Integrator4bindER10Simulation"],"mdk::Integrator::bind::simulation":[35,6,1,"_CPPv4N3mdk10Integrator4bindER10Simulation"],"mdk::Integrator::init":[35,5,1,"_CPPv4N3mdk10Integrator4initEv"],"mdk::Integrator::integrate":[35,5,1,"_CPPv4N3mdk10Integrator9integrateEv"],"mdk::Integrator::state":[35,3,1,"_CPPv4N3mdk10Integrator5stateE"],"mdk::Joule":[57,3,1,"_CPPv4N3mdk5JouleE"],"mdk::Kelvin":[57,3,1,"_CPPv4N3mdk6KelvinE"],"mdk::LEU":[2,4,1,"_CPPv4N3mdk12AminoAcidIdx3LEUE"],"mdk::LYS":[2,4,1,"_CPPv4N3mdk12AminoAcidIdx3LYSE"],"mdk::LambdaPeak":[27,2,1,"_CPPv4N3mdk10LambdaPeakE"],"mdk::LambdaPeak::alpha":[27,3,1,"_CPPv4N3mdk10LambdaPeak5alphaE"],"mdk::LambdaPeak::cosineVersion":[27,3,1,"_CPPv4N3mdk10LambdaPeak13cosineVersionE"],"mdk::LambdaPeak::eval":[27,5,1,"_CPPv4NK3mdk10LambdaPeak4evalEdRdRd"],"mdk::LambdaPeak::eval::L":[27,6,1,"_CPPv4NK3mdk10LambdaPeak4evalEdRdRd"],"mdk::LambdaPeak::eval::dL_dpsi":[27,6,1,"_CPPv4NK3mdk10LambdaPeak4evalEdRdRd"],"mdk::LambdaPeak::eval::psi":[27,6,1,"_CPPv4NK3mdk10LambdaPeak4evalEdRdRd"],"mdk::LambdaPeak::psi0":[27,3,1,"_CPPv4N3mdk10LambdaPeak4psi0E"],"mdk::LambdaPeak::supp":[27,5,1,"_CPPv4NK3mdk10LambdaPeak4suppEd"],"mdk::LambdaPeak::supp::psi":[27,6,1,"_CPPv4NK3mdk10LambdaPeak4suppEd"],"mdk::LangPredictorCorrector":[36,2,1,"_CPPv4N3mdk22LangPredictorCorrectorE"],"mdk::LangPredictorCorrector::LangPredictorCorrector":[36,5,1,"_CPPv4N3mdk22LangPredictorCorrector22LangPredictorCorrectorEd"],"mdk::LangPredictorCorrector::LangPredictorCorrector::dt":[36,6,1,"_CPPv4N3mdk22LangPredictorCorrector22LangPredictorCorrectorEd"],"mdk::LangPredictorCorrector::bind":[36,5,1,"_CPPv4N3mdk22LangPredictorCorrector4bindER10Simulation"],"mdk::LangPredictorCorrector::bind::simulation":[36,6,1,"_CPPv4N3mdk22LangPredictorCorrector4bindER10Simulation"],"mdk::LangPredictorCorrector::dt":[36,3,1,"_CPPv4N3mdk22LangPredictorCorrector2dtE"],"mdk::LangPredictorCorrector::gamma":[36,3,1,"_CPPv4N3mdk22LangPredictorCorrector5gammaE"],"mdk::LangPredictorCorrector::gaussianNoise":[36,3,1,"_CPPv4N3mdk22LangPredictorCorrector13gaussianNoiseE"],"mdk::LangPredictorCorrector::generateNoise":[36,5,1,"_CPPv4N3mdk22LangPredictorCorrector13generateNoiseEv"],"mdk::LangPredictorCorrector::init":[36,5,1,"_CPPv4N3mdk22LangPredictorCorrector4initEv"],"mdk::LangPredictorCorrector::initialized":[36,3,1,"_CPPv4N3mdk22LangPredictorCorrector11initializedE"],"mdk::LangPredictorCorrector::integrate":[36,5,1,"_CPPv4N3mdk22LangPredictorCorrector9integrateEv"],"mdk::LangPredictorCorrector::m":[36,3,1,"_CPPv4N3mdk22LangPredictorCorrector1mE"],"mdk::LangPredictorCorrector::random":[36,3,1,"_CPPv4N3mdk22LangPredictorCorrector6randomE"],"mdk::LangPredictorCorrector::rngs":[36,3,1,"_CPPv4N3mdk22LangPredictorCorrector4rngsE"],"mdk::LangPredictorCorrector::temperature":[36,3,1,"_CPPv4N3mdk22LangPredictorCorrector11temperatureE"],"mdk::LangPredictorCorrector::y0":[36,3,1,"_CPPv4N3mdk22LangPredictorCorrector2y0E"],"mdk::LangPredictorCorrector::y1":[36,3,1,"_CPPv4N3mdk22LangPredictorCorrector2y1E"],"mdk::LangPredictorCorrector::y2":[36,3,1,"_CPPv4N3mdk22LangPredictorCorrector2y2E"],"mdk::LangPredictorCorrector::y3":[36,3,1,"_CPPv4N3mdk22LangPredictorCorrector2y3E"],"mdk::LangPredictorCorrector::y4":[36,3,1,"_CPPv4N3mdk22LangPredictorCorrector2y4E"],"mdk::LangPredictorCorrector::y5":[36,3,1,"_CPPv4N3mdk22LangPredictorCorrector2y5E"],"mdk::Leapfrog":[37,2,1,"_CPPv4N3mdk8LeapfrogE"],"mdk::Leapfrog::Leapfrog":[37,5,1,"_CPPv4N3mdk8Leapfrog8LeapfrogEd"],"mdk::Leapfrog::Leapfrog::dt":[37,6,1,"_CPPv4N3mdk8Leapfrog8LeapfrogEd"],"mdk::Leapfrog::a_prev":[37,3,1,"_CPPv4N3mdk8Leapfrog6a_prevE"],"mdk::Leapfrog::bind":[37,5,1,"_CPPv4N3mdk8Leapfrog4bindER10Simulation"],"mdk::Leapfrog::bind::simulation":[37,6,1,"_CPPv4N3mdk8Leapfrog4bindER10Simulation"],"mdk::Leapfrog::dt":[37,3,1,"_CPPv4N3mdk8Leapfrog2dtE"],"mdk::Leapfrog::init":[37,5,1,"_CPPv4N3mdk8Leapfrog4initEv"],"mdk::Leapfrog::integrate":[37,5,1,"_CPPv4N3mdk8Leapfrog9integrateEv"],"mdk::Leapfrog::m":[37,3,1,"_CPPv4N3mdk8Leapfrog1mE"],"mdk::LennardJones":[40,2,1,"_CPPv4N3mdk12LennardJonesE"],"mdk::LennardJones::LennardJones":[40,5,1,"_CPPv4N3mdk12LennardJones12LennardJonesEv"],"mdk::LennardJones::LennardJones::depth":[40,6,1,"_CPPv4N3mdk12LennardJones12LennardJonesEdd"],"mdk::LennardJones::LennardJones::r_min":[40,6,1,"_CPPv4N3mdk12LennardJones12LennardJonesEdd"],"mdk::LennardJones::computeF":[40,5,1,"_CPPv4I00ENK3mdk12LennardJones8computeFEv4VRefdRd2T12T2"],"mdk::LennardJones::computeF::F1":[40,6,1,"_CPPv4I00ENK3mdk12LennardJones8computeFEv4VRefdRd2T12T2"],"mdk::LennardJones::computeF::F2":[40,6,1,"_CPPv4I00ENK3mdk12LennardJones8computeFEv4VRefdRd2T12T2"],"mdk::LennardJones::computeF::T1":[40,8,1,"_CPPv4I00ENK3mdk12LennardJones8computeFEv4VRefdRd2T12T2"],"mdk::LennardJones::computeF::T2":[40,8,1,"_CPPv4I00ENK3mdk12LennardJones8computeFEv4VRefdRd2T12T2"],"mdk::LennardJones::computeF::V":[40,6,1,"_CPPv4I00ENK3mdk12LennardJones8computeFEv4VRefdRd2T12T2"],"mdk::LennardJones::computeF::norm":[40,6,1,"_CPPv4I00ENK3mdk12LennardJones8computeFEv4VRefdRd2T12T2"],"mdk::LennardJones::computeF::unit":[40,6,1,"_CPPv4I00ENK3mdk12LennardJones8computeFEv4VRefdRd2T12T2"],"mdk::LennardJones::computeV":[40,5,1,"_CPPv4NK3mdk12LennardJones8computeVEdRdRd"],"mdk::LennardJones::computeV::V":[40,6,1,"_CPPv4NK3mdk12LennardJones8computeVEdRdRd"],"mdk::LennardJones::computeV::dV_dn":[40,6,1,"_CPPv4NK3mdk12LennardJones8computeVEdRdRd"],"mdk::LennardJones::computeV::norm":[40,6,1,"_CPPv4NK3mdk12LennardJones8computeVEdRdRd"],"mdk::LennardJones::cutoff":[40,5,1,"_CPPv4NK3mdk12LennardJones6cutoffEv"],"mdk::LennardJones::depth":[40,3,1,"_CPPv4N3mdk12LennardJones5depthE"],"mdk::LennardJones::r_min":[40,3,1,"_CPPv4N3mdk12LennardJones5r_minE"],"mdk::MET":[2,4,1,"_CPPv4N3mdk12AminoAcidIdx3METE"],"mdk::Masses":[18,2,1,"_CPPv4N3mdk6MassesE"],"mdk::Masses::Masses":[18,5,1,"_CPPv4N3mdk6Masses6MassesEv"],"mdk::Masses::Masses::model":[18,6,1,"_CPPv4N3mdk6Masses6MassesERK5Model"],"mdk::Model":[6,2,1,"_CPPv4N3mdk5ModelE"],"mdk::Model::Chain":[6,2,1,"_CPPv4N3mdk5Model5ChainE"],"mdk::Model::Chain::end":[6,3,1,"_CPPv4N3mdk5Model5Chain3endE"],"mdk::Model::Chain::idx":[6,3,1,"_CPPv4N3mdk5Model5Chain3idxE"],"mdk::Model::Chain::start":[6,3,1,"_CPPv4N3mdk5Model5Chain5startE"],"mdk::Model::Chain::structuredParts":[6,3,1,"_CPPv4N3mdk5Model5Chain15structuredPartsE"],"mdk::Model::Contact":[6,2,1,"_CPPv4N3mdk5Model7ContactE"],"mdk::Model::Contact::dist0":[6,3,1,"_CPPv4N3mdk5Model7Contact5dist0E"],"mdk::Model::Contact::idx":[6,3,1,"_CPPv4N3mdk5Model7Contact3idxE"],"mdk::Model::Contact::res":[6,3,1,"_CPPv4N3mdk5Model7Contact3resE"],"mdk::Model::Contact::type":[6,3,1,"_CPPv4N3mdk5Model7Contact4typeE"],"mdk::Model::Residue":[6,2,1,"_CPPv4N3mdk5Model7ResidueE"],"mdk::Model::Residue::chainIdx":[6,3,1,"_CPPv4N3mdk5Model7Residue8chainIdxE"],"mdk::Model::Residue::idx":[6,3,1,"_CPPv4N3mdk5Model7Residue3idxE"],"mdk::Model::Residue::mass":[6,3,1,"_CPPv4N3mdk5Model7Residue4massE"],"mdk::Model::Residue::nat_r":[6,3,1,"_CPPv4N3mdk5Model7Residue5nat_rE"],"mdk::Model::Residue::r":[6,3,1,"_CPPv4N3mdk5Model7Residue1rE"],"mdk::Model::Residue::type":[6,3,1,"_CPPv4N3mdk5Model7Residue4typeE"],"mdk::Model::Residue::v":[6,3,1,"_CPPv4N3mdk5Model7Residue1vE"],"mdk::Model::StructuredPart":[6,2,1,"_CPPv4N3mdk5Model14StructuredPartE"],"mdk::Model::StructuredPart::angle":[6,3,1,"_CPPv4N3mdk5Model14StructuredPart5angleE"],"mdk::Model::StructuredPart::dihedral":[6,3,1,"_CPPv4N3mdk5Model14StructuredPart8dihedralE"],"mdk::Model::StructuredPart::idx":[6,3,1,"_CPPv4N3mdk5Model14StructuredPart3idxE"],"mdk::Model::StructuredPart::len":[6,3,1,"_CPPv4N3mdk5Model14StructuredPart3lenE"],"mdk::Model::StructuredPart::off":[6,3,1,"_CPPv4N3mdk5Model14StructuredPart3offE"],"mdk::Model::addCMapContacts":[6,5,1,"_CPPv4N3mdk5Model15addCMapContactsERKN4cmap10ContactMapER5Chain"],"mdk::Model::addCMapContacts::chain":[6,6,1,"_CPPv4N3mdk5Model15addCMapContactsERKN4cmap10ContactMapER5Chain"],"mdk::Model::addCMapContacts::contactMap":[6,6,1,"_CPPv4N3mdk5Model15addCMapContactsERKN4cmap10ContactMapER5Chain"],"mdk::Model::addChain":[6,5,1,"_CPPv4N3mdk5Model8addChainEv"],"mdk::Model::addContact":[6,5,1,"_CPPv4N3mdk5Model10addContactEv"],"mdk::Model::addContactMap":[6,5,1,"_CPPv4N3mdk5Model13addContactMapERKN4cmap10ContactMapE"],"mdk::Model::addContactMap::contactMap":[6,6,1,"_CPPv4N3mdk5Model13addContactMapERKN4cmap10ContactMapE"],"mdk::Model::addResidue":[6,5,1,"_CPPv4N3mdk5Model10addResidueEP5Chain"],"mdk::Model::addResidue::chain":[6,6,1,"_CPPv4N3mdk5Model10addResidueEP5Chain"],"mdk::Model::addSP":[6,5,1,"_CPPv4N3mdk5Model5addSPEv"],"mdk::Model::chains":[6,3,1,"_CPPv4N3mdk5Model6chainsE"],"mdk::Model::contacts":[6,3,1,"_CPPv4N3mdk5Model8contactsE"],"mdk::Model::exactLegacySAW":[6,5,1,"_CPPv4N3mdk5Model14exactLegacySAWER6Randombddd"],"mdk::Model::exactLegacySAW::bond":[6,6,1,"_CPPv4N3mdk5Model14exactLegacySAWER6Randombddd"],"mdk::Model::exactLegacySAW::density":[6,6,1,"_CPPv4N3mdk5Model14exactLegacySAWER6Randombddd"],"mdk::Model::exactLegacySAW::minDist":[6,6,1,"_CPPv4N3mdk5Model14exactLegacySAWER6Randombddd"],"mdk::Model::exactLegacySAW::rand":[6,6,1,"_CPPv4N3mdk5Model14exactLegacySAWER6Randombddd"],"mdk::Model::exactLegacySAW::useTop":[6,6,1,"_CPPv4N3mdk5Model14exactLegacySAWER6Randombddd"],"mdk::Model::initVelocity":[6,5,1,"_CPPv4N3mdk5Model12initVelocityER6Randomdb"],"mdk::Model::initVelocity::rand":[6,6,1,"_CPPv4N3mdk5Model12initVelocityER6Randomdb"],"mdk::Model::initVelocity::temperature":[6,6,1,"_CPPv4N3mdk5Model12initVelocityER6Randomdb"],"mdk::Model::initVelocity::useMass":[6,6,1,"_CPPv4N3mdk5Model12initVelocityER6Randomdb"],"mdk::Model::legacyMorphIntoSAW":[6,5,1,"_CPPv4N3mdk5Model18legacyMorphIntoSAWER6Randombddb"],"mdk::Model::legacyMorphIntoSAW::density":[6,6,1,"_CPPv4N3mdk5Model18legacyMorphIntoSAWER6Randombddb"],"mdk::Model::legacyMorphIntoSAW::minDist":[6,6,1,"_CPPv4N3mdk5Model18legacyMorphIntoSAWER6Randombddb"],"mdk::Model::legacyMorphIntoSAW::nativeBondLen":[6,6,1,"_CPPv4N3mdk5Model18legacyMorphIntoSAWER6Randombddb"],"mdk::Model::legacyMorphIntoSAW::rand":[6,6,1,"_CPPv4N3mdk5Model18legacyMorphIntoSAWER6Randombddb"],"mdk::Model::legacyMorphIntoSAW::useTop":[6,6,1,"_CPPv4N3mdk5Model18legacyMorphIntoSAWER6Randombddb"],"mdk::Model::morphIntoLine":[6,5,1,"_CPPv4N3mdk5Model13morphIntoLineEv"],"mdk::Model::morphIntoSAW":[6,5,1,"_CPPv4N3mdk5Model12morphIntoSAWER6Randombdd"],"mdk::Model::morphIntoSAW::density":[6,6,1,"_CPPv4N3mdk5Model12morphIntoSAWER6Randombdd"],"mdk::Model::morphIntoSAW::minDist":[6,6,1,"_CPPv4N3mdk5Model12morphIntoSAWER6Randombdd"],"mdk::Model::morphIntoSAW::rand":[6,6,1,"_CPPv4N3mdk5Model12morphIntoSAWER6Randombdd"],"mdk::Model::morphIntoSAW::useTop":[6,6,1,"_CPPv4N3mdk5Model12morphIntoSAWER6Randombdd"],"mdk::Model::n":[6,3,1,"_CPPv4N3mdk5Model1nE"],"mdk::Model::nonlocalPairs":[6,5,1,"_CPPv4N3mdk5Model13nonlocalPairsEv"],"mdk::Model::residues":[6,3,1,"_CPPv4N3mdk5Model8residuesE"],"mdk::Model::structuredParts":[6,3,1,"_CPPv4N3mdk5Model15structuredPartsE"],"mdk::Model::top":[6,3,1,"_CPPv4N3mdk5Model3topE"],"mdk::Model::useAverageMasses":[6,5,1,"_CPPv4N3mdk5Model16useAverageMassesEv"],"mdk::NAT":[2,4,1,"_CPPv4N3mdk14ContactTypeIdx3NATE"],"mdk::NAT_BB":[2,4,1,"_CPPv4N3mdk14ContactTypeIdx6NAT_BBE"],"mdk::NAT_BS":[2,4,1,"_CPPv4N3mdk14ContactTypeIdx6NAT_BSE"],"mdk::NAT_SB":[2,4,1,"_CPPv4N3mdk14ContactTypeIdx6NAT_SBE"],"mdk::NAT_SS":[2,4,1,"_CPPv4N3mdk14ContactTypeIdx6NAT_SSE"],"mdk::NativeBA":[19,2,1,"_CPPv4N3mdk8NativeBAE"],"mdk::NativeBA::CBA":[19,3,1,"_CPPv4N3mdk8NativeBA3CBAE"],"mdk::NativeBA::bind":[19,5,1,"_CPPv4N3mdk8NativeBA4bindER10Simulation"],"mdk::NativeBA::bind::simulation":[19,6,1,"_CPPv4N3mdk8NativeBA4bindER10Simulation"],"mdk::NativeBA::isNative":[19,3,1,"_CPPv4N3mdk8NativeBA8isNativeE"],"mdk::NativeBA::term":[19,5,1,"_CPPv4NK3mdk8NativeBA4termEidRdRd"],"mdk::NativeBA::term::V":[19,6,1,"_CPPv4NK3mdk8NativeBA4termEidRdRd"],"mdk::NativeBA::term::dV_dth":[19,6,1,"_CPPv4NK3mdk8NativeBA4termEidRdRd"],"mdk::NativeBA::term::i":[19,6,1,"_CPPv4NK3mdk8NativeBA4termEidRdRd"],"mdk::NativeBA::term::theta":[19,6,1,"_CPPv4NK3mdk8NativeBA4termEidRdRd"],"mdk::NativeBA::theta0":[19,3,1,"_CPPv4N3mdk8NativeBA6theta0E"],"mdk::NativeContacts":[23,2,1,"_CPPv4N3mdk14NativeContactsE"],"mdk::NativeContacts::Contact":[23,2,1,"_CPPv4N3mdk14NativeContacts7ContactE"],"mdk::NativeContacts::Contact::i1":[23,3,1,"_CPPv4N3mdk14NativeContacts7Contact2i1E"],"mdk::NativeContacts::Contact::i2":[23,3,1,"_CPPv4N3mdk14NativeContacts7Contact2i2E"],"mdk::NativeContacts::Contact::r_min":[23,3,1,"_CPPv4N3mdk14NativeContacts7Contact5r_minE"],"mdk::NativeContacts::allContacts":[23,3,1,"_CPPv4N3mdk14NativeContacts11allContactsE"],"mdk::NativeContacts::asyncPart":[23,5,1,"_CPPv4N3mdk14NativeContacts9asyncPartER8Dynamics"],"mdk::NativeContacts::asyncPart::dynamics":[23,6,1,"_CPPv4N3mdk14NativeContacts9asyncPartER8Dynamics"],"mdk::NativeContacts::bind":[23,5,1,"_CPPv4N3mdk14NativeContacts4bindER10Simulation"],"mdk::NativeContacts::bind::simulation":[23,6,1,"_CPPv4N3mdk14NativeContacts4bindER10Simulation"],"mdk::NativeContacts::curPairs":[23,3,1,"_CPPv4N3mdk14NativeContacts8curPairsE"],"mdk::NativeContacts::depth":[23,3,1,"_CPPv4N3mdk14NativeContacts5depthE"],"mdk::NativeContacts::newVL":[23,3,1,"_CPPv4N3mdk14NativeContacts5newVLE"],"mdk::NativeContacts::spec":[23,5,1,"_CPPv4NK3mdk14NativeContacts4specEv"],"mdk::NativeContacts::vlUpdateHook":[23,5,1,"_CPPv4N3mdk14NativeContacts12vlUpdateHookEv"],"mdk::NativeDihedralBase":[21,2,1,"_CPPv4N3mdk18NativeDihedralBaseE"],"mdk::NativeDihedralBase::bind":[21,5,1,"_CPPv4N3mdk18NativeDihedralBase4bindER10Simulation"],"mdk::NativeDihedralBase::bind::simulation":[21,6,1,"_CPPv4N3mdk18NativeDihedralBase4bindER10Simulation"],"mdk::NativeDihedralBase::isNative":[21,3,1,"_CPPv4N3mdk18NativeDihedralBase8isNativeE"],"mdk::NativeDihedralBase::phi0":[21,3,1,"_CPPv4N3mdk18NativeDihedralBase4phi0E"],"mdk::NonlocalForce":[25,2,1,"_CPPv4N3mdk13NonlocalForceE"],"mdk::NonlocalForce::bind":[25,5,1,"_CPPv4N3mdk13NonlocalForce4bindER10Simulation"],"mdk::NonlocalForce::bind::simulation":[25,6,1,"_CPPv4N3mdk13NonlocalForce4bindER10Simulation"],"mdk::NonlocalForce::installIntoVL":[25,5,1,"_CPPv4N3mdk13NonlocalForce13installIntoVLEv"],"mdk::NonlocalForce::savedSpec":[25,3,1,"_CPPv4N3mdk13NonlocalForce9savedSpecE"],"mdk::NonlocalForce::spec":[25,5,1,"_CPPv4NK3mdk13NonlocalForce4specEv"],"mdk::NonlocalForce::vl":[25,3,1,"_CPPv4N3mdk13NonlocalForce2vlE"],"mdk::NonlocalForce::vlUpdateHook":[25,5,1,"_CPPv4N3mdk13NonlocalForce12vlUpdateHookEv"],"mdk::PG":[2,4,1,"_CPPv4N3mdk8PairType2PGE"],"mdk::PHE":[2,4,1,"_CPPv4N3mdk12AminoAcidIdx3PHEE"],"mdk::PP":[2,4,1,"_CPPv4N3mdk8PairType2PPE"],"mdk::PRO":[2,4,1,"_CPPv4N3mdk12AminoAcidIdx3PROE"],"mdk::PX":[2,4,1,"_CPPv4N3mdk8PairType2PXE"],"mdk::PairType":[53,7,1,"_CPPv4N3mdk8PairTypeE"],"mdk::PairType::GG":[53,4,1,"_CPPv4N3mdk8PairType2GGE"],"mdk::PairType::GP":[53,4,1,"_CPPv4N3mdk8PairType2GPE"],"mdk::PairType::GX":[53,4,1,"_CPPv4N3mdk8PairType2GXE"],"mdk::PairType::PG":[53,4,1,"_CPPv4N3mdk8PairType2PGE"],"mdk::PairType::PP":[53,4,1,"_CPPv4N3mdk8PairType2PPE"],"mdk::PairType::PX":[53,4,1,"_CPPv4N3mdk8PairType2PXE"],"mdk::PairType::XG":[53,4,1,"_CPPv4N3mdk8PairType2XGE"],"mdk::PairType::XP":[53,4,1,"_CPPv4N3mdk8PairType2XPE"],"mdk::PairType::XX":[53,4,1,"_CPPv4N3mdk8PairType2XXE"],"mdk::Pairs":[43,1,1,"_CPPv4N3mdk5PairsE"],"mdk::PauliExclusion":[26,2,1,"_CPPv4N3mdk14PauliExclusionE"],"mdk::PauliExclusion::PauliExclusion":[26,5,1,"_CPPv4N3mdk14PauliExclusion14PauliExclusionEv"],"mdk::PauliExclusion::asyncPart":[26,5,1,"_CPPv4N3mdk14PauliExclusion9asyncPartER8Dynamics"],"mdk::PauliExclusion::asyncPart::dynamics":[26,6,1,"_CPPv4N3mdk14PauliExclusion9asyncPartER8Dynamics"],"mdk::PauliExclusion::bind":[26,5,1,"_CPPv4N3mdk14PauliExclusion4bindER10Simulation"],"mdk::PauliExclusion::bind::simulation":[26,6,1,"_CPPv4N3mdk14PauliExclusion4bindER10Simulation"],"mdk::PauliExclusion::exclPairs":[26,3,1,"_CPPv4N3mdk14PauliExclusion9exclPairsE"],"mdk::PauliExclusion::spec":[26,5,1,"_CPPv4NK3mdk14PauliExclusion4specEv"],"mdk::PauliExclusion::stlj":[26,3,1,"_CPPv4N3mdk14PauliExclusion4stljE"],"mdk::PauliExclusion::vlUpdateHook":[26,5,1,"_CPPv4N3mdk14PauliExclusion12vlUpdateHookEv"],"mdk::PositionDiff":[32,2,1,"_CPPv4N3mdk12PositionDiffE"],"mdk::PositionDiff::PositionDiff":[32,5,1,"_CPPv4N3mdk12PositionDiff12PositionDiffENSt6stringERKNSt6stringE"],"mdk::PositionDiff::PositionDiff::inputPath":[32,6,1,"_CPPv4N3mdk12PositionDiff12PositionDiffENSt6stringERKNSt6stringE"],"mdk::PositionDiff::PositionDiff::outputPath":[32,6,1,"_CPPv4N3mdk12PositionDiff12PositionDiffENSt6stringERKNSt6stringE"],"mdk::PositionDiff::bind":[32,5,1,"_CPPv4N3mdk12PositionDiff4bindER10Simulation"],"mdk::PositionDiff::bind::simulation":[32,6,1,"_CPPv4N3mdk12PositionDiff4bindER10Simulation"],"mdk::PositionDiff::execute":[32,5,1,"_CPPv4N3mdk12PositionDiff7executeEi"],"mdk::PositionDiff::execute::step_nr":[32,6,1,"_CPPv4N3mdk12PositionDiff7executeEi"],"mdk::PositionDiff::inputPath":[32,3,1,"_CPPv4N3mdk12PositionDiff9inputPathE"],"mdk::PositionDiff::output":[32,3,1,"_CPPv4N3mdk12PositionDiff6outputE"],"mdk::PositionDiff::refPositions":[32,3,1,"_CPPv4N3mdk12PositionDiff12refPositionsE"],"mdk::PositionDiff::state":[32,3,1,"_CPPv4N3mdk12PositionDiff5stateE"],"mdk::ProgressBar":[33,2,1,"_CPPv4N3mdk11ProgressBarE"],"mdk::ProgressBar::ProgressBar":[33,5,1,"_CPPv4N3mdk11ProgressBar11ProgressBarEddi"],"mdk::ProgressBar::ProgressBar::totalTime":[33,6,1,"_CPPv4N3mdk11ProgressBar11ProgressBarEddi"],"mdk::ProgressBar::ProgressBar::updatePeriod":[33,6,1,"_CPPv4N3mdk11ProgressBar11ProgressBarEddi"],"mdk::ProgressBar::ProgressBar::width":[33,6,1,"_CPPv4N3mdk11ProgressBar11ProgressBarEddi"],"mdk::ProgressBar::bind":[33,5,1,"_CPPv4N3mdk11ProgressBar4bindER10Simulation"],"mdk::ProgressBar::bind::simulation":[33,6,1,"_CPPv4N3mdk11ProgressBar4bindER10Simulation"],"mdk::ProgressBar::execute":[33,5,1,"_CPPv4N3mdk11ProgressBar7executeEi"],"mdk::ProgressBar::execute::step_nr":[33,6,1,"_CPPv4N3mdk11ProgressBar7executeEi"],"mdk::ProgressBar::prevTime":[33,3,1,"_CPPv4N3mdk11ProgressBar8prevTimeE"],"mdk::ProgressBar::realTime0":[33,3,1,"_CPPv4N3mdk11ProgressBar9realTime0E"],"mdk::ProgressBar::simul":[33,3,1,"_CPPv4N3mdk11ProgressBar5simulE"],"mdk::ProgressBar::state":[33,3,1,"_CPPv4N3mdk11ProgressBar5stateE"],"mdk::ProgressBar::time_point":[33,1,1,"_CPPv4N3mdk11ProgressBar10time_pointE"],"mdk::ProgressBar::totalTime":[33,3,1,"_CPPv4N3mdk11ProgressBar9totalTimeE"],"mdk::ProgressBar::updatePeriod":[33,3,1,"_CPPv4N3mdk11ProgressBar12updatePeriodE"],"mdk::ProgressBar::width":[33,3,1,"_CPPv4N3mdk11ProgressBar5widthE"],"mdk::PseudoImproperDihedral":[27,2,1,"_CPPv4N3mdk22PseudoImproperDihedralE"],"mdk::PseudoImproperDihedral::asyncPart":[27,5,1,"_CPPv4N3mdk22PseudoImproperDihedral9asyncPartER8Dynamics"],"mdk::PseudoImproperDihedral::asyncPart::dynamics":[27,6,1,"_CPPv4N3mdk22PseudoImproperDihedral9asyncPartER8Dynamics"],"mdk::PseudoImproperDihedral::bb_neg":[27,3,1,"_CPPv4N3mdk22PseudoImproperDihedral6bb_negE"],"mdk::PseudoImproperDihedral::bb_neg_lj":[27,3,1,"_CPPv4N3mdk22PseudoImproperDihedral9bb_neg_ljE"],"mdk::PseudoImproperDihedral::bb_pos":[27,3,1,"_CPPv4N3mdk22PseudoImproperDihedral6bb_posE"],"mdk::PseudoImproperDihedral::bb_pos_lj":[27,3,1,"_CPPv4N3mdk22PseudoImproperDihedral9bb_pos_ljE"],"mdk::PseudoImproperDihedral::bind":[27,5,1,"_CPPv4N3mdk22PseudoImproperDihedral4bindER10Simulation"],"mdk::PseudoImproperDihedral::bind::simulation":[27,6,1,"_CPPv4N3mdk22PseudoImproperDihedral4bindER10Simulation"],"mdk::PseudoImproperDihedral::deriveAngles":[27,5,1,"_CPPv4NK3mdk22PseudoImproperDihedral12deriveAnglesERKN2vl8PairInfoEAL2E_dAL2E_AL6E_6Vector"],"mdk::PseudoImproperDihedral::deriveAngles::dpsi_dr":[27,6,1,"_CPPv4NK3mdk22PseudoImproperDihedral12deriveAnglesERKN2vl8PairInfoEAL2E_dAL2E_AL6E_6Vector"],"mdk::PseudoImproperDihedral::deriveAngles::pair":[27,6,1,"_CPPv4NK3mdk22PseudoImproperDihedral12deriveAnglesERKN2vl8PairInfoEAL2E_dAL2E_AL6E_6Vector"],"mdk::PseudoImproperDihedral::deriveAngles::psi":[27,6,1,"_CPPv4NK3mdk22PseudoImproperDihedral12deriveAnglesERKN2vl8PairInfoEAL2E_dAL2E_AL6E_6Vector"],"mdk::PseudoImproperDihedral::pairs":[27,3,1,"_CPPv4N3mdk22PseudoImproperDihedral5pairsE"],"mdk::PseudoImproperDihedral::seqs":[27,3,1,"_CPPv4N3mdk22PseudoImproperDihedral4seqsE"],"mdk::PseudoImproperDihedral::spec":[27,5,1,"_CPPv4NK3mdk22PseudoImproperDihedral4specEv"],"mdk::PseudoImproperDihedral::ss":[27,3,1,"_CPPv4N3mdk22PseudoImproperDihedral2ssE"],"mdk::PseudoImproperDihedral::ss_ljs":[27,3,1,"_CPPv4N3mdk22PseudoImproperDihedral6ss_ljsE"],"mdk::PseudoImproperDihedral::types":[27,3,1,"_CPPv4N3mdk22PseudoImproperDihedral5typesE"],"mdk::PseudoImproperDihedral::vlUpdateHook":[27,5,1,"_CPPv4N3mdk22PseudoImproperDihedral12vlUpdateHookEv"],"mdk::QAContact":[28,2,1,"_CPPv4N3mdk9QAContactE"],"mdk::QAContact::BREAKING":[2,4,1,"_CPPv4N3mdk9QAContact6Status8BREAKINGE"],"mdk::QAContact::FORMING":[2,4,1,"_CPPv4N3mdk9QAContact6Status7FORMINGE"],"mdk::QAContact::REMOVED":[2,4,1,"_CPPv4N3mdk9QAContact6Status7REMOVEDE"],"mdk::QAContact::Status":[28,7,1,"_CPPv4N3mdk9QAContact6StatusE"],"mdk::QAContact::Status::BREAKING":[28,4,1,"_CPPv4N3mdk9QAContact6Status8BREAKINGE"],"mdk::QAContact::Status::FORMING":[28,4,1,"_CPPv4N3mdk9QAContact6Status7FORMINGE"],"mdk::QAContact::Status::REMOVED":[28,4,1,"_CPPv4N3mdk9QAContact6Status7REMOVEDE"],"mdk::QAContact::i1":[28,3,1,"_CPPv4N3mdk9QAContact2i1E"],"mdk::QAContact::i2":[28,3,1,"_CPPv4N3mdk9QAContact2i2E"],"mdk::QAContact::status":[28,3,1,"_CPPv4N3mdk9QAContact6statusE"],"mdk::QAContact::t0":[28,3,1,"_CPPv4N3mdk9QAContact2t0E"],"mdk::QAContact::type":[28,3,1,"_CPPv4N3mdk9QAContact4typeE"],"mdk::QADiff":[28,2,1,"_CPPv4N3mdk6QADiffE"],"mdk::QADiff::cont":[28,3,1,"_CPPv4N3mdk6QADiff4contE"],"mdk::QADiff::oldIdx":[28,3,1,"_CPPv4N3mdk6QADiff6oldIdxE"],"mdk::QADiff::operator&lt;":[28,5,1,"_CPPv4NK3mdk6QADiffltERK6QADiff"],"mdk::QADiff::operator&lt;::other":[28,6,1,"_CPPv4NK3mdk6QADiffltERK6QADiff"],"mdk::QADiff::statDiffs":[28,3,1,"_CPPv4N3mdk6QADiff9statDiffsE"],"mdk::QAFreePair":[28,2,1,"_CPPv4N3mdk10QAFreePairE"],"mdk::QAFreePair::FREE":[2,4,1,"_CPPv4N3mdk10QAFreePair6Status4FREEE"],"mdk::QAFreePair::Status":[28,7,1,"_CPPv4N3mdk10QAFreePair6StatusE"],"mdk::QAFreePair::Status::FREE":[28,4,1,"_CPPv4N3mdk10QAFreePair6Status4FREEE"],"mdk::QAFreePair::Status::TAKEN":[28,4,1,"_CPPv4N3mdk10QAFreePair6Status5TAKENE"],"mdk::QAFreePair::TAKEN":[2,4,1,"_CPPv4N3mdk10QAFreePair6Status5TAKENE"],"mdk::QAFreePair::i1":[28,3,1,"_CPPv4N3mdk10QAFreePair2i1E"],"mdk::QAFreePair::i2":[28,3,1,"_CPPv4N3mdk10QAFreePair2i2E"],"mdk::QAFreePair::status":[28,3,1,"_CPPv4N3mdk10QAFreePair6statusE"],"mdk::QuasiAdiabatic":[28,2,1,"_CPPv4N3mdk14QuasiAdiabaticE"],"mdk::QuasiAdiabatic::asyncPart":[28,5,1,"_CPPv4N3mdk14QuasiAdiabatic9asyncPartER8Dynamics"],"mdk::QuasiAdiabatic::asyncPart::dynamics":[28,6,1,"_CPPv4N3mdk14QuasiAdiabatic9asyncPartER8Dynamics"],"mdk::QuasiAdiabatic::bb_lj":[28,3,1,"_CPPv4N3mdk14QuasiAdiabatic5bb_ljE"],"mdk::QuasiAdiabatic::bind":[28,5,1,"_CPPv4N3mdk14QuasiAdiabatic4bindER10Simulation"],"mdk::QuasiAdiabatic::bind::simulation":[28,6,1,"_CPPv4N3mdk14QuasiAdiabatic4bindER10Simulation"],"mdk::QuasiAdiabatic::breakingTime":[28,3,1,"_CPPv4N3mdk14QuasiAdiabatic12breakingTimeE"],"mdk::QuasiAdiabatic::breakingTolerance":[28,3,1,"_CPPv4N3mdk14QuasiAdiabatic17breakingToleranceE"],"mdk::QuasiAdiabatic::bs_lj":[28,3,1,"_CPPv4N3mdk14QuasiAdiabatic5bs_ljE"],"mdk::QuasiAdiabatic::chains":[28,3,1,"_CPPv4N3mdk14QuasiAdiabatic6chainsE"],"mdk::QuasiAdiabatic::computeNH":[28,5,1,"_CPPv4N3mdk14QuasiAdiabatic9computeNHEv"],"mdk::QuasiAdiabatic::formationMaxDistSq":[28,3,1,"_CPPv4N3mdk14QuasiAdiabatic18formationMaxDistSqE"],"mdk::QuasiAdiabatic::formationTime":[28,3,1,"_CPPv4N3mdk14QuasiAdiabatic13formationTimeE"],"mdk::QuasiAdiabatic::formationTolerance":[28,3,1,"_CPPv4N3mdk14QuasiAdiabatic18formationToleranceE"],"mdk::QuasiAdiabatic::freePairs":[28,3,1,"_CPPv4N3mdk14QuasiAdiabatic9freePairsE"],"mdk::QuasiAdiabatic::geometryPhase":[28,5,1,"_CPPv4NK3mdk14QuasiAdiabatic13geometryPhaseERKN2vl8PairInfoER6QADiff"],"mdk::QuasiAdiabatic::geometryPhase::diff":[28,6,1,"_CPPv4NK3mdk14QuasiAdiabatic13geometryPhaseERKN2vl8PairInfoER6QADiff"],"mdk::QuasiAdiabatic::geometryPhase::p":[28,6,1,"_CPPv4NK3mdk14QuasiAdiabatic13geometryPhaseERKN2vl8PairInfoER6QADiff"],"mdk::QuasiAdiabatic::h":[28,3,1,"_CPPv4N3mdk14QuasiAdiabatic1hE"],"mdk::QuasiAdiabatic::hh_abs_min":[28,3,1,"_CPPv4N3mdk14QuasiAdiabatic10hh_abs_minE"],"mdk::QuasiAdiabatic::hr_abs_min":[28,3,1,"_CPPv4N3mdk14QuasiAdiabatic10hr_abs_minE"],"mdk::QuasiAdiabatic::n":[28,3,1,"_CPPv4N3mdk14QuasiAdiabatic1nE"],"mdk::QuasiAdiabatic::nr_max":[28,3,1,"_CPPv4N3mdk14QuasiAdiabatic6nr_maxE"],"mdk::QuasiAdiabatic::oldPairs":[28,3,1,"_CPPv4N3mdk14QuasiAdiabatic8oldPairsE"],"mdk::QuasiAdiabatic::pairs":[28,3,1,"_CPPv4N3mdk14QuasiAdiabatic5pairsE"],"mdk::QuasiAdiabatic::qaDiffs":[28,3,1,"_CPPv4N3mdk14QuasiAdiabatic7qaDiffsE"],"mdk::QuasiAdiabatic::qaDiffsMutex":[28,3,1,"_CPPv4N3mdk14QuasiAdiabatic12qaDiffsMutexE"],"mdk::QuasiAdiabatic::spec":[28,5,1,"_CPPv4NK3mdk14QuasiAdiabatic4specEv"],"mdk::QuasiAdiabatic::ss_ljs":[28,3,1,"_CPPv4N3mdk14QuasiAdiabatic6ss_ljsE"],"mdk::QuasiAdiabatic::stats":[28,3,1,"_CPPv4N3mdk14QuasiAdiabatic5statsE"],"mdk::QuasiAdiabatic::syncPart":[28,5,1,"_CPPv4N3mdk14QuasiAdiabatic8syncPartER8Dynamics"],"mdk::QuasiAdiabatic::syncPart::dynamics":[28,6,1,"_CPPv4N3mdk14QuasiAdiabatic8syncPartER8Dynamics"],"mdk::QuasiAdiabatic::types":[28,3,1,"_CPPv4N3mdk14QuasiAdiabatic5typesE"],"mdk::QuasiAdiabatic::vlUpdateHook":[28,5,1,"_CPPv4N3mdk14QuasiAdiabatic12vlUpdateHookEv"],"mdk::Random":[54,2,1,"_CPPv4N3mdk6RandomE"],"mdk::Random::Random":[54,5,1,"_CPPv4N3mdk6Random6RandomEv"],"mdk::Random::Random::oth":[54,6,1,"_CPPv4N3mdk6Random6RandomERK6Random"],"mdk::Random::Random::seed":[54,6,1,"_CPPv4N3mdk6Random6RandomEi"],"mdk::Random::getNewRandom":[54,5,1,"_CPPv4N3mdk6Random12getNewRandomEv"],"mdk::Random::normal":[54,5,1,"_CPPv4N3mdk6Random6normalEv"],"mdk::Random::normal::mu":[54,6,1,"_CPPv4N3mdk6Random6normalEdd"],"mdk::Random::normal::sigma":[54,6,1,"_CPPv4N3mdk6Random6normalEdd"],"mdk::Random::sphere":[54,5,1,"_CPPv4N3mdk6Random6sphereEv"],"mdk::Random::state":[54,3,1,"_CPPv4N3mdk6Random5stateE"],"mdk::Random::two_normals":[54,5,1,"_CPPv4N3mdk6Random11two_normalsEv"],"mdk::Random::uniform":[54,5,1,"_CPPv4N3mdk6Random7uniformEv"],"mdk::Random::uniform::a":[54,6,1,"_CPPv4N3mdk6Random7uniformEdd"],"mdk::Random::uniform::b":[54,6,1,"_CPPv4N3mdk6Random7uniformEdd"],"mdk::RelativeDH":[22,2,1,"_CPPv4N3mdk10RelativeDHE"],"mdk::RelativeDH::asyncPart":[22,5,1,"_CPPv4N3mdk10RelativeDH9asyncPartER8Dynamics"],"mdk::RelativeDH::asyncPart::dynamics":[22,6,1,"_CPPv4N3mdk10RelativeDH9asyncPartER8Dynamics"],"mdk::RelativeDH::r0":[22,3,1,"_CPPv4N3mdk10RelativeDH2r0E"],"mdk::RelativeDH::screeningDist":[22,3,1,"_CPPv4N3mdk10RelativeDH13screeningDistE"],"mdk::RelativeDH::spec":[22,5,1,"_CPPv4NK3mdk10RelativeDH4specEv"],"mdk::ResType":[55,2,1,"_CPPv4N3mdk7ResTypeE"],"mdk::ResType::ResType":[55,5,1,"_CPPv4N3mdk7ResType7ResTypeEv"],"mdk::ResType::ResType::code":[55,6,1,"_CPPv4N3mdk7ResType7ResTypeE10ResTypeIdx"],"mdk::ResType::ResType::name":[55,6,1,"_CPPv4N3mdk7ResType7ResTypeERKNSt6stringE"],"mdk::ResType::ResType::x":[55,6,1,"_CPPv4N3mdk7ResType7ResTypeE6int8_t"],"mdk::ResType::code":[55,3,1,"_CPPv4N3mdk7ResType4codeE"],"mdk::ResType::mass":[55,5,1,"_CPPv4NK3mdk7ResType4massEv"],"mdk::ResType::operator ResTypeIdx const&amp;":[55,5,1,"_CPPv4NK3mdk7ResTypecvRK10ResTypeIdxEv"],"mdk::ResType::operator int8_t":[55,5,1,"_CPPv4NK3mdk7ResTypecv6int8_tEv"],"mdk::ResType::operator std::string":[55,5,1,"_CPPv4NK3mdk7ResTypecvNSt6stringEEv"],"mdk::ResTypeIdx":[55,7,1,"_CPPv4N3mdk10ResTypeIdxE"],"mdk::ResTypeIdx::ALA":[55,4,1,"_CPPv4N3mdk10ResTypeIdx3ALAE"],"mdk::ResTypeIdx::ARG":[55,4,1,"_CPPv4N3mdk10ResTypeIdx3ARGE"],"mdk::ResTypeIdx::ASN":[55,4,1,"_CPPv4N3mdk10ResTypeIdx3ASNE"],"mdk::ResTypeIdx::ASP":[55,4,1,"_CPPv4N3mdk10ResTypeIdx3ASPE"],"mdk::ResTypeIdx::CYS":[55,4,1,"_CPPv4N3mdk10ResTypeIdx3CYSE"],"mdk::ResTypeIdx::GLN":[55,4,1,"_CPPv4N3mdk10ResTypeIdx3GLNE"],"mdk::ResTypeIdx::GLU":[55,4,1,"_CPPv4N3mdk10ResTypeIdx3GLUE"],"mdk::ResTypeIdx::GLY":[55,4,1,"_CPPv4N3mdk10ResTypeIdx3GLYE"],"mdk::ResTypeIdx::HIS":[55,4,1,"_CPPv4N3mdk10ResTypeIdx3HISE"],"mdk::ResTypeIdx::ILE":[55,4,1,"_CPPv4N3mdk10ResTypeIdx3ILEE"],"mdk::ResTypeIdx::LEU":[55,4,1,"_CPPv4N3mdk10ResTypeIdx3LEUE"],"mdk::ResTypeIdx::LYS":[55,4,1,"_CPPv4N3mdk10ResTypeIdx3LYSE"],"mdk::ResTypeIdx::MET":[55,4,1,"_CPPv4N3mdk10ResTypeIdx3METE"],"mdk::ResTypeIdx::PHE":[55,4,1,"_CPPv4N3mdk10ResTypeIdx3PHEE"],"mdk::ResTypeIdx::PRO":[55,4,1,"_CPPv4N3mdk10ResTypeIdx3PROE"],"mdk::ResTypeIdx::SER":[55,4,1,"_CPPv4N3mdk10ResTypeIdx3SERE"],"mdk::ResTypeIdx::THR":[55,4,1,"_CPPv4N3mdk10ResTypeIdx3THRE"],"mdk::ResTypeIdx::TRP":[55,4,1,"_CPPv4N3mdk10ResTypeIdx3TRPE"],"mdk::ResTypeIdx::TYR":[55,4,1,"_CPPv4N3mdk10ResTypeIdx3TYRE"],"mdk::ResTypeIdx::VAL":[55,4,1,"_CPPv4N3mdk10ResTypeIdx3VALE"],"mdk::SER":[2,4,1,"_CPPv4N3mdk12AminoAcidIdx3SERE"],"mdk::SSBOND":[2,4,1,"_CPPv4N3mdk14ContactTypeIdx6SSBONDE"],"mdk::Scalars":[43,1,1,"_CPPv4N3mdk7ScalarsE"],"mdk::ShiftedTruncatedLJ":[42,2,1,"_CPPv4N3mdk18ShiftedTruncatedLJE"],"mdk::ShiftedTruncatedLJ::ShiftedTruncatedLJ":[42,5,1,"_CPPv4N3mdk18ShiftedTruncatedLJ18ShiftedTruncatedLJEv"],"mdk::ShiftedTruncatedLJ::ShiftedTruncatedLJ::depth":[42,6,1,"_CPPv4N3mdk18ShiftedTruncatedLJ18ShiftedTruncatedLJEdd"],"mdk::ShiftedTruncatedLJ::ShiftedTruncatedLJ::r_cut":[42,6,1,"_CPPv4N3mdk18ShiftedTruncatedLJ18ShiftedTruncatedLJEdd"],"mdk::ShiftedTruncatedLJ::computeF":[42,5,1,"_CPPv4I00ENK3mdk18ShiftedTruncatedLJ8computeFEv4VRefdRd2T12T2"],"mdk::ShiftedTruncatedLJ::computeF::F1":[42,6,1,"_CPPv4I00ENK3mdk18ShiftedTruncatedLJ8computeFEv4VRefdRd2T12T2"],"mdk::ShiftedTruncatedLJ::computeF::F2":[42,6,1,"_CPPv4I00ENK3mdk18ShiftedTruncatedLJ8computeFEv4VRefdRd2T12T2"],"mdk::ShiftedTruncatedLJ::computeF::T1":[42,8,1,"_CPPv4I00ENK3mdk18ShiftedTruncatedLJ8computeFEv4VRefdRd2T12T2"],"mdk::ShiftedTruncatedLJ::computeF::T2":[42,8,1,"_CPPv4I00ENK3mdk18ShiftedTruncatedLJ8computeFEv4VRefdRd2T12T2"],"mdk::ShiftedTruncatedLJ::computeF::V":[42,6,1,"_CPPv4I00ENK3mdk18ShiftedTruncatedLJ8computeFEv4VRefdRd2T12T2"],"mdk::ShiftedTruncatedLJ::computeF::norm":[42,6,1,"_CPPv4I00ENK3mdk18ShiftedTruncatedLJ8computeFEv4VRefdRd2T12T2"],"mdk::ShiftedTruncatedLJ::computeF::unit":[42,6,1,"_CPPv4I00ENK3mdk18ShiftedTruncatedLJ8computeFEv4VRefdRd2T12T2"],"mdk::ShiftedTruncatedLJ::computeV":[42,5,1,"_CPPv4NK3mdk18ShiftedTruncatedLJ8computeVEdRdRd"],"mdk::ShiftedTruncatedLJ::computeV::V":[42,6,1,"_CPPv4NK3mdk18ShiftedTruncatedLJ8computeVEdRdRd"],"mdk::ShiftedTruncatedLJ::computeV::dV_dn":[42,6,1,"_CPPv4NK3mdk18ShiftedTruncatedLJ8computeVEdRdRd"],"mdk::ShiftedTruncatedLJ::computeV::norm":[42,6,1,"_CPPv4NK3mdk18ShiftedTruncatedLJ8computeVEdRdRd"],"mdk::ShiftedTruncatedLJ::cutoff":[42,5,1,"_CPPv4NK3mdk18ShiftedTruncatedLJ6cutoffEv"],"mdk::ShiftedTruncatedLJ::depth":[42,3,1,"_CPPv4N3mdk18ShiftedTruncatedLJ5depthE"],"mdk::ShiftedTruncatedLJ::r_cut":[42,3,1,"_CPPv4N3mdk18ShiftedTruncatedLJ5r_cutE"],"mdk::SidechainLJ":[41,2,1,"_CPPv4N3mdk11SidechainLJE"],"mdk::SidechainLJ::SidechainLJ":[41,5,1,"_CPPv4N3mdk11SidechainLJ11SidechainLJEv"],"mdk::SidechainLJ::SidechainLJ::depth":[41,6,1,"_CPPv4N3mdk11SidechainLJ11SidechainLJEdd"],"mdk::SidechainLJ::SidechainLJ::sink_max":[41,6,1,"_CPPv4N3mdk11SidechainLJ11SidechainLJEdd"],"mdk::SidechainLJ::computeF":[41,5,1,"_CPPv4I00ENK3mdk11SidechainLJ8computeFEv4VRefdRd2T12T2"],"mdk::SidechainLJ::computeF::F1":[41,6,1,"_CPPv4I00ENK3mdk11SidechainLJ8computeFEv4VRefdRd2T12T2"],"mdk::SidechainLJ::computeF::F2":[41,6,1,"_CPPv4I00ENK3mdk11SidechainLJ8computeFEv4VRefdRd2T12T2"],"mdk::SidechainLJ::computeF::T1":[41,8,1,"_CPPv4I00ENK3mdk11SidechainLJ8computeFEv4VRefdRd2T12T2"],"mdk::SidechainLJ::computeF::T2":[41,8,1,"_CPPv4I00ENK3mdk11SidechainLJ8computeFEv4VRefdRd2T12T2"],"mdk::SidechainLJ::computeF::V":[41,6,1,"_CPPv4I00ENK3mdk11SidechainLJ8computeFEv4VRefdRd2T12T2"],"mdk::SidechainLJ::computeF::norm":[41,6,1,"_CPPv4I00ENK3mdk11SidechainLJ8computeFEv4VRefdRd2T12T2"],"mdk::SidechainLJ::computeF::unit":[41,6,1,"_CPPv4I00ENK3mdk11SidechainLJ8computeFEv4VRefdRd2T12T2"],"mdk::SidechainLJ::computeV":[41,5,1,"_CPPv4NK3mdk11SidechainLJ8computeVEdRdRd"],"mdk::SidechainLJ::computeV::V":[41,6,1,"_CPPv4NK3mdk11SidechainLJ8computeVEdRdRd"],"mdk::SidechainLJ::computeV::dV_dn":[41,6,1,"_CPPv4NK3mdk11SidechainLJ8computeVEdRdRd"],"mdk::SidechainLJ::computeV::norm":[41,6,1,"_CPPv4NK3mdk11SidechainLJ8computeVEdRdRd"],"mdk::SidechainLJ::cutoff":[41,5,1,"_CPPv4NK3mdk11SidechainLJ6cutoffEv"],"mdk::SidechainLJ::depth":[41,3,1,"_CPPv4N3mdk11SidechainLJ5depthE"],"mdk::SidechainLJ::sink_max":[41,3,1,"_CPPv4N3mdk11SidechainLJ8sink_maxE"],"mdk::SimpleNativeDihedral":[21,2,1,"_CPPv4N3mdk20SimpleNativeDihedralE"],"mdk::SimpleNativeDihedral::CDH":[21,3,1,"_CPPv4N3mdk20SimpleNativeDihedral3CDHE"],"mdk::SimpleNativeDihedral::bind":[21,5,1,"_CPPv4N3mdk20SimpleNativeDihedral4bindER10Simulation"],"mdk::SimpleNativeDihedral::bind::simulation":[21,6,1,"_CPPv4N3mdk20SimpleNativeDihedral4bindER10Simulation"],"mdk::SimpleNativeDihedral::term":[21,5,1,"_CPPv4NK3mdk20SimpleNativeDihedral4termEidRdRd"],"mdk::SimpleNativeDihedral::term::V":[21,6,1,"_CPPv4NK3mdk20SimpleNativeDihedral4termEidRdRd"],"mdk::SimpleNativeDihedral::term::dV_dphi":[21,6,1,"_CPPv4NK3mdk20SimpleNativeDihedral4termEidRdRd"],"mdk::SimpleNativeDihedral::term::i":[21,6,1,"_CPPv4NK3mdk20SimpleNativeDihedral4termEidRdRd"],"mdk::SimpleNativeDihedral::term::phi":[21,6,1,"_CPPv4NK3mdk20SimpleNativeDihedral4termEidRdRd"],"mdk::SimulVar":[45,2,1,"_CPPv4N3mdk8SimulVarE"],"mdk::SimulVar::bind":[45,5,1,"_CPPv4N3mdk8SimulVar4bindER10Simulation"],"mdk::SimulVar::bind::simulation":[45,6,1,"_CPPv4N3mdk8SimulVar4bindER10Simulation"],"mdk::Simulation":[44,2,1,"_CPPv4N3mdk10SimulationE"],"mdk::Simulation::Simulation":[44,5,1,"_CPPv4N3mdk10Simulation10SimulationE5ModelN5param10ParametersE"],"mdk::Simulation::Simulation::model":[44,6,1,"_CPPv4N3mdk10Simulation10SimulationE5ModelN5param10ParametersE"],"mdk::Simulation::Simulation::params":[44,6,1,"_CPPv4N3mdk10Simulation10SimulationE5ModelN5param10ParametersE"],"mdk::Simulation::add":[44,5,1,"_CPPv4I0DpEN3mdk10Simulation3addER1TDpRR4Args"],"mdk::Simulation::add::Args":[44,8,1,"_CPPv4I0DpEN3mdk10Simulation3addER1TDpRR4Args"],"mdk::Simulation::add::T":[44,8,1,"_CPPv4I0DpEN3mdk10Simulation3addER1TDpRR4Args"],"mdk::Simulation::add::args":[44,6,1,"_CPPv4I0DpEN3mdk10Simulation3addER1TDpRR4Args"],"mdk::Simulation::addAsyncTask":[44,5,1,"_CPPv4N3mdk10Simulation12addAsyncTaskERKNSt8functionIFvvEEE"],"mdk::Simulation::addAsyncTask::f":[44,6,1,"_CPPv4N3mdk10Simulation12addAsyncTaskERKNSt8functionIFvvEEE"],"mdk::Simulation::asyncTasks":[44,3,1,"_CPPv4N3mdk10Simulation10asyncTasksE"],"mdk::Simulation::calcForces":[44,5,1,"_CPPv4N3mdk10Simulation10calcForcesEv"],"mdk::Simulation::data":[44,5,1,"_CPPv4I0EN3mdk10Simulation4dataERK4Datav"],"mdk::Simulation::data::Data":[44,8,1,"_CPPv4I0EN3mdk10Simulation4dataERK4Datav"],"mdk::Simulation::df":[44,3,1,"_CPPv4N3mdk10Simulation2dfE"],"mdk::Simulation::forces":[44,3,1,"_CPPv4N3mdk10Simulation6forcesE"],"mdk::Simulation::hooks":[44,3,1,"_CPPv4N3mdk10Simulation5hooksE"],"mdk::Simulation::init":[44,5,1,"_CPPv4N3mdk10Simulation4initEv"],"mdk::Simulation::initialized":[44,3,1,"_CPPv4N3mdk10Simulation11initializedE"],"mdk::Simulation::integrator":[44,3,1,"_CPPv4N3mdk10Simulation10integratorE"],"mdk::Simulation::model":[44,3,1,"_CPPv4N3mdk10Simulation5modelE"],"mdk::Simulation::nonlocalForces":[44,3,1,"_CPPv4N3mdk10Simulation14nonlocalForcesE"],"mdk::Simulation::params":[44,3,1,"_CPPv4N3mdk10Simulation6paramsE"],"mdk::Simulation::state":[44,3,1,"_CPPv4N3mdk10Simulation5stateE"],"mdk::Simulation::step":[44,5,1,"_CPPv4N3mdk10Simulation4stepEv"],"mdk::Simulation::step::t":[44,6,1,"_CPPv4N3mdk10Simulation4stepEd"],"mdk::Simulation::step_nr":[44,3,1,"_CPPv4N3mdk10Simulation7step_nrE"],"mdk::Simulation::var":[44,5,1,"_CPPv4I0EN3mdk10Simulation3varER3Varv"],"mdk::Simulation::var::Var":[44,8,1,"_CPPv4I0EN3mdk10Simulation3varER3Varv"],"mdk::Simulation::vars":[44,3,1,"_CPPv4N3mdk10Simulation4varsE"],"mdk::Simulation::verlet_list":[44,3,1,"_CPPv4N3mdk10Simulation11verlet_listE"],"mdk::SolidWall":[2,2,1,"_CPPv4N3mdk9SolidWallE"],"mdk::SolidWall::asyncPart":[2,5,1,"_CPPv4N3mdk9SolidWall9asyncPartER8Dynamics"],"mdk::SolidWall::asyncPart::dynamics":[2,6,1,"_CPPv4N3mdk9SolidWall9asyncPartER8Dynamics"],"mdk::SolidWall::wall":[2,3,1,"_CPPv4N3mdk9SolidWall4wallE"],"mdk::Stat":[47,2,1,"_CPPv4N3mdk4StatE"],"mdk::Stat::backbone":[47,3,1,"_CPPv4N3mdk4Stat8backboneE"],"mdk::Stat::hydrophobicSS":[47,3,1,"_CPPv4N3mdk4Stat13hydrophobicSSE"],"mdk::Stat::operator+":[47,5,1,"_CPPv4NK3mdk4StatplERK4Stat"],"mdk::Stat::operator+::other":[47,6,1,"_CPPv4NK3mdk4StatplERK4Stat"],"mdk::Stat::operator+=":[47,5,1,"_CPPv4N3mdk4StatpLERK4Stat"],"mdk::Stat::operator+=::other":[47,6,1,"_CPPv4N3mdk4StatpLERK4Stat"],"mdk::Stat::operator-":[47,5,1,"_CPPv4NK3mdk4StatmiEv"],"mdk::Stat::operator-::other":[47,6,1,"_CPPv4NK3mdk4StatmiERK4Stat"],"mdk::Stat::operator-=":[47,5,1,"_CPPv4N3mdk4StatmIERK4Stat"],"mdk::Stat::operator-=::other":[47,6,1,"_CPPv4N3mdk4StatmIERK4Stat"],"mdk::Stat::polarSS":[47,3,1,"_CPPv4N3mdk4Stat7polarSSE"],"mdk::Stat::sidechain":[47,3,1,"_CPPv4N3mdk4Stat9sidechainE"],"mdk::Stat::valid":[47,5,1,"_CPPv4NK3mdk4Stat5validEv"],"mdk::State":[46,2,1,"_CPPv4N3mdk5StateE"],"mdk::State::bind":[46,5,1,"_CPPv4N3mdk5State4bindER10Simulation"],"mdk::State::bind::simul":[46,6,1,"_CPPv4N3mdk5State4bindER10Simulation"],"mdk::State::dyn":[46,3,1,"_CPPv4N3mdk5State3dynE"],"mdk::State::exportTo":[46,5,1,"_CPPv4NK3mdk5State8exportToER5Model"],"mdk::State::exportTo::model":[46,6,1,"_CPPv4NK3mdk5State8exportToER5Model"],"mdk::State::n":[46,3,1,"_CPPv4N3mdk5State1nE"],"mdk::State::prepareDyn":[46,5,1,"_CPPv4N3mdk5State10prepareDynEv"],"mdk::State::r":[46,3,1,"_CPPv4N3mdk5State1rE"],"mdk::State::t":[46,3,1,"_CPPv4N3mdk5State1tE"],"mdk::State::top":[46,3,1,"_CPPv4N3mdk5State3topE"],"mdk::State::updateWithDyn":[46,5,1,"_CPPv4N3mdk5State13updateWithDynERK8Dynamics"],"mdk::State::updateWithDyn::othDyn":[46,6,1,"_CPPv4N3mdk5State13updateWithDynERK8Dynamics"],"mdk::State::v":[46,3,1,"_CPPv4N3mdk5State1vE"],"mdk::Stats":[47,2,1,"_CPPv4N3mdk5StatsE"],"mdk::Stats::BB":[2,4,1,"_CPPv4N3mdk5Stats4Type2BBE"],"mdk::Stats::BS":[2,4,1,"_CPPv4N3mdk5Stats4Type2BSE"],"mdk::Stats::SB":[2,4,1,"_CPPv4N3mdk5Stats4Type2SBE"],"mdk::Stats::SS":[2,4,1,"_CPPv4N3mdk5Stats4Type2SSE"],"mdk::Stats::Type":[47,7,1,"_CPPv4N3mdk5Stats4TypeE"],"mdk::Stats::Type::BB":[47,4,1,"_CPPv4N3mdk5Stats4Type2BBE"],"mdk::Stats::Type::BS":[47,4,1,"_CPPv4N3mdk5Stats4Type2BSE"],"mdk::Stats::Type::SB":[47,4,1,"_CPPv4N3mdk5Stats4Type2SBE"],"mdk::Stats::Type::SS":[47,4,1,"_CPPv4N3mdk5Stats4Type2SSE"],"mdk::Stats::bind":[47,5,1,"_CPPv4N3mdk5Stats4bindER10Simulation"],"mdk::Stats::bind::simulation":[47,6,1,"_CPPv4N3mdk5Stats4bindER10Simulation"],"mdk::Stats::creationDiffs":[47,5,1,"_CPPv4NK3mdk5Stats13creationDiffsEii4TypeAL2E_4Stat"],"mdk::Stats::creationDiffs::diffs":[47,6,1,"_CPPv4NK3mdk5Stats13creationDiffsEii4TypeAL2E_4Stat"],"mdk::Stats::creationDiffs::i1":[47,6,1,"_CPPv4NK3mdk5Stats13creationDiffsEii4TypeAL2E_4Stat"],"mdk::Stats::creationDiffs::i2":[47,6,1,"_CPPv4NK3mdk5Stats13creationDiffsEii4TypeAL2E_4Stat"],"mdk::Stats::creationDiffs::type":[47,6,1,"_CPPv4NK3mdk5Stats13creationDiffsEii4TypeAL2E_4Stat"],"mdk::Stats::polarization":[47,3,1,"_CPPv4N3mdk5Stats12polarizationE"],"mdk::Stats::stats":[47,3,1,"_CPPv4N3mdk5Stats5statsE"],"mdk::Stats::types":[47,3,1,"_CPPv4N3mdk5Stats5typesE"],"mdk::THR":[2,4,1,"_CPPv4N3mdk12AminoAcidIdx3THRE"],"mdk::TRP":[2,4,1,"_CPPv4N3mdk12AminoAcidIdx3TRPE"],"mdk::TYR":[2,4,1,"_CPPv4N3mdk12AminoAcidIdx3TYRE"],"mdk::Tether":[29,2,1,"_CPPv4N3mdk6TetherE"],"mdk::Tether::Tether":[29,5,1,"_CPPv4N3mdk6Tether6TetherEb"],"mdk::Tether::Tether::fromNative":[29,6,1,"_CPPv4N3mdk6Tether6TetherEb"],"mdk::Tether::asyncPart":[29,5,1,"_CPPv4N3mdk6Tether9asyncPartER8Dynamics"],"mdk::Tether::asyncPart::dynamics":[29,6,1,"_CPPv4N3mdk6Tether9asyncPartER8Dynamics"],"mdk::Tether::bind":[29,5,1,"_CPPv4N3mdk6Tether4bindER10Simulation"],"mdk::Tether::bind::simulation":[29,6,1,"_CPPv4N3mdk6Tether4bindER10Simulation"],"mdk::Tether::dist0":[29,3,1,"_CPPv4N3mdk6Tether5dist0E"],"mdk::Tether::fromNative":[29,3,1,"_CPPv4N3mdk6Tether10fromNativeE"],"mdk::Tether::harm":[29,3,1,"_CPPv4N3mdk6Tether4harmE"],"mdk::Tether::isConnected":[29,3,1,"_CPPv4N3mdk6Tether11isConnectedE"],"mdk::Tether::n":[29,3,1,"_CPPv4N3mdk6Tether1nE"],"mdk::Topology":[56,2,1,"_CPPv4N3mdk8TopologyE"],"mdk::Topology::cell":[56,3,1,"_CPPv4N3mdk8Topology4cellE"],"mdk::Topology::cellInv":[56,3,1,"_CPPv4N3mdk8Topology7cellInvE"],"mdk::Topology::fix":[56,5,1,"_CPPv4NK3mdk8Topology3fixER6Vector"],"mdk::Topology::fix::v":[56,6,1,"_CPPv4NK3mdk8Topology3fixER6Vector"],"mdk::Topology::operator()":[56,5,1,"_CPPv4NK3mdk8TopologyclE6Vector"],"mdk::Topology::operator()::v":[56,6,1,"_CPPv4NK3mdk8TopologyclE6Vector"],"mdk::Topology::setCell":[56,5,1,"_CPPv4N3mdk8Topology7setCellE4VRef"],"mdk::Topology::setCell::cell":[56,6,1,"_CPPv4N3mdk8Topology7setCellE4VRef"],"mdk::Topology::use":[56,3,1,"_CPPv4N3mdk8Topology3useE"],"mdk::Types":[43,2,1,"_CPPv4N3mdk5TypesE"],"mdk::Types::Types":[43,5,1,"_CPPv4N3mdk5Types5TypesEv"],"mdk::Types::Types::model":[43,6,1,"_CPPv4N3mdk5Types5TypesERK5Model"],"mdk::VAL":[2,4,1,"_CPPv4N3mdk12AminoAcidIdx3VALE"],"mdk::VRef":[43,1,1,"_CPPv4N3mdk4VRefE"],"mdk::Vector":[43,1,1,"_CPPv4N3mdk6VectorE"],"mdk::VectorBase":[43,1,1,"_CPPv4N3mdk10VectorBaseE"],"mdk::Vectors":[43,2,1,"_CPPv4N3mdk7VectorsE"],"mdk::Vectors::Vectors":[43,5,1,"_CPPv4N3mdk7Vectors7VectorsEv"],"mdk::Vectors::Vectors::init":[43,6,1,"_CPPv4N3mdk7Vectors7VectorsEiRK6Vector"],"mdk::Vectors::Vectors::n":[43,6,1,"_CPPv4N3mdk7Vectors7VectorsEiRK6Vector"],"mdk::Vectors::operator[]":[43,5,1,"_CPPv4NK3mdk7VectorsixEi"],"mdk::Vectors::operator[]::i":[43,6,1,"_CPPv4NK3mdk7VectorsixEi"],"mdk::Vectors::size":[43,5,1,"_CPPv4NK3mdk7Vectors4sizeEv"],"mdk::Vectors::vectorwise":[43,5,1,"_CPPv4NK3mdk7Vectors10vectorwiseEv"],"mdk::XG":[2,4,1,"_CPPv4N3mdk8PairType2XGE"],"mdk::XP":[2,4,1,"_CPPv4N3mdk8PairType2XPE"],"mdk::XX":[2,4,1,"_CPPv4N3mdk8PairType2XXE"],"mdk::angle":[2,5,1,"_CPPv4N3mdk5angleE4VRef4VRef4VRef"],"mdk::angle::v1":[2,6,1,"_CPPv4N3mdk5angleE4VRef4VRef4VRef"],"mdk::angle::v2":[2,6,1,"_CPPv4N3mdk5angleE4VRef4VRef4VRef"],"mdk::angle::v3":[2,6,1,"_CPPv4N3mdk5angleE4VRef4VRef4VRef"],"mdk::angstrom":[57,3,1,"_CPPv4N3mdk8angstromE"],"mdk::asphericity":[2,5,1,"_CPPv4N3mdk11asphericityERK7Vectors"],"mdk::asphericity::v":[2,6,1,"_CPPv4N3mdk11asphericityERK7Vectors"],"mdk::atom":[57,3,1,"_CPPv4N3mdk4atomE"],"mdk::au":[57,3,1,"_CPPv4N3mdk2auE"],"mdk::cmap":[2,1,1,"_CPPv4N3mdk4cmapE"],"mdk::cmap::ContactMap":[4,2,1,"_CPPv4N3mdk4cmap10ContactMapE"],"mdk::cmap::ContactMap::Contact":[4,2,1,"_CPPv4N3mdk4cmap10ContactMap7ContactE"],"mdk::cmap::ContactMap::Contact::dist0":[4,3,1,"_CPPv4N3mdk4cmap10ContactMap7Contact5dist0E"],"mdk::cmap::ContactMap::Contact::res":[4,3,1,"_CPPv4N3mdk4cmap10ContactMap7Contact3resE"],"mdk::cmap::ContactMap::angle":[4,3,1,"_CPPv4N3mdk4cmap10ContactMap5angleE"],"mdk::cmap::ContactMap::contacts":[4,3,1,"_CPPv4N3mdk4cmap10ContactMap8contactsE"],"mdk::cmap::ContactMap::dihedral":[4,3,1,"_CPPv4N3mdk4cmap10ContactMap8dihedralE"],"mdk::cmap::ContactMap::len":[4,3,1,"_CPPv4N3mdk4cmap10ContactMap3lenE"],"mdk::cmap::ContactMap::offset":[4,3,1,"_CPPv4N3mdk4cmap10ContactMap6offsetE"],"mdk::cmap::LegacyParser":[4,2,1,"_CPPv4N3mdk4cmap12LegacyParserE"],"mdk::cmap::LegacyParser::read":[4,5,1,"_CPPv4N3mdk4cmap12LegacyParser4readERNSt7istreamE"],"mdk::cmap::LegacyParser::read::is":[4,6,1,"_CPPv4N3mdk4cmap12LegacyParser4readERNSt7istreamE"],"mdk::cmap::LegacyParser::write":[4,5,1,"_CPPv4N3mdk4cmap12LegacyParser5writeERNSt7ostreamERK10ContactMap"],"mdk::cmap::LegacyParser::write::cmap":[4,6,1,"_CPPv4N3mdk4cmap12LegacyParser5writeERNSt7ostreamERK10ContactMap"],"mdk::cmap::LegacyParser::write::os":[4,6,1,"_CPPv4N3mdk4cmap12LegacyParser5writeERNSt7ostreamERK10ContactMap"],"mdk::cspeed":[57,3,1,"_CPPv4N3mdk6cspeedE"],"mdk::degree":[57,3,1,"_CPPv4N3mdk6degreeE"],"mdk::dihedral":[2,5,1,"_CPPv4N3mdk8dihedralE4VRef4VRef4VRef4VRef"],"mdk::dihedral::v1":[2,6,1,"_CPPv4N3mdk8dihedralE4VRef4VRef4VRef4VRef"],"mdk::dihedral::v2":[2,6,1,"_CPPv4N3mdk8dihedralE4VRef4VRef4VRef4VRef"],"mdk::dihedral::v3":[2,6,1,"_CPPv4N3mdk8dihedralE4VRef4VRef4VRef4VRef"],"mdk::dihedral::v4":[2,6,1,"_CPPv4N3mdk8dihedralE4VRef4VRef4VRef4VRef"],"mdk::echarge":[57,3,1,"_CPPv4N3mdk7echargeE"],"mdk::eps":[57,3,1,"_CPPv4N3mdk3epsE"],"mdk::eps_kB":[57,3,1,"_CPPv4N3mdk6eps_kBE"],"mdk::epsilon_0":[57,3,1,"_CPPv4N3mdk9epsilon_0E"],"mdk::f77mass":[57,3,1,"_CPPv4N3mdk7f77massE"],"mdk::f77unit":[57,3,1,"_CPPv4N3mdk7f77unitE"],"mdk::kB":[57,3,1,"_CPPv4N3mdk2kBE"],"mdk::kcal":[57,3,1,"_CPPv4N3mdk4kcalE"],"mdk::kg":[57,3,1,"_CPPv4N3mdk2kgE"],"mdk::line":[2,5,1,"_CPPv4N3mdk4lineERNSt7istreamE"],"mdk::line::is":[2,6,1,"_CPPv4N3mdk4lineERNSt7istreamE"],"mdk::lineStream":[2,5,1,"_CPPv4N3mdk10lineStreamERNSt7istreamE"],"mdk::lineStream::is":[2,6,1,"_CPPv4N3mdk10lineStreamERNSt7istreamE"],"mdk::ltrim":[2,5,1,"_CPPv4N3mdk5ltrimENSt11string_viewE"],"mdk::ltrim::s":[2,6,1,"_CPPv4N3mdk5ltrimENSt11string_viewE"],"mdk::meter":[57,3,1,"_CPPv4N3mdk5meterE"],"mdk::microsecond":[57,3,1,"_CPPv4N3mdk11microsecondE"],"mdk::millisecond":[57,3,1,"_CPPv4N3mdk11millisecondE"],"mdk::mol":[57,3,1,"_CPPv4N3mdk3molE"],"mdk::mu_0":[57,3,1,"_CPPv4N3mdk4mu_0E"],"mdk::nanometer":[57,3,1,"_CPPv4N3mdk9nanometerE"],"mdk::nanosecond":[57,3,1,"_CPPv4N3mdk10nanosecondE"],"mdk::numOfPTs":[53,3,1,"_CPPv4N3mdk8numOfPTsE"],"mdk::pairType":[53,5,1,"_CPPv4N3mdk8pairTypeERK9AminoAcidRK9AminoAcid"],"mdk::pairType::acid1":[53,6,1,"_CPPv4N3mdk8pairTypeERK9AminoAcidRK9AminoAcid"],"mdk::pairType::acid2":[53,6,1,"_CPPv4N3mdk8pairTypeERK9AminoAcidRK9AminoAcid"],"mdk::pairTypes":[53,5,1,"_CPPv4N3mdk9pairTypesEv"],"mdk::param":[2,1,1,"_CPPv4N3mdk5paramE"],"mdk::param::GLY_PRO":[2,4,1,"_CPPv4N3mdk5param12Polarization7GLY_PROE"],"mdk::param::HYDROPHOBIC":[2,4,1,"_CPPv4N3mdk5param12Polarization11HYDROPHOBICE"],"mdk::param::LegacyParser":[7,2,1,"_CPPv4N3mdk5param12LegacyParserE"],"mdk::param::LegacyParser::read":[7,5,1,"_CPPv4N3mdk5param12LegacyParser4readERNSt7istreamE"],"mdk::param::LegacyParser::read::is":[7,6,1,"_CPPv4N3mdk5param12LegacyParser4readERNSt7istreamE"],"mdk::param::LegacyParser::write":[7,5,1,"_CPPv4N3mdk5param12LegacyParser5writeERNSt7ostreamERK10Parameters"],"mdk::param::LegacyParser::write::data":[7,6,1,"_CPPv4N3mdk5param12LegacyParser5writeERNSt7ostreamERK10Parameters"],"mdk::param::LegacyParser::write::os":[7,6,1,"_CPPv4N3mdk5param12LegacyParser5writeERNSt7ostreamERK10Parameters"],"mdk::param::MISSING":[2,4,1,"_CPPv4N3mdk5param12Polarization7MISSINGE"],"mdk::param::POLAR":[2,4,1,"_CPPv4N3mdk5param12Polarization5POLARE"],"mdk::param::POLAR_NEG":[2,4,1,"_CPPv4N3mdk5param12Polarization9POLAR_NEGE"],"mdk::param::POLAR_POS":[2,4,1,"_CPPv4N3mdk5param12Polarization9POLAR_POSE"],"mdk::param::Parameters":[7,2,1,"_CPPv4N3mdk5param10ParametersE"],"mdk::param::Parameters::Coeffs":[7,1,1,"_CPPv4N3mdk5param10Parameters6CoeffsE"],"mdk::param::Parameters::Parameters":[7,5,1,"_CPPv4N3mdk5param10Parameters10ParametersEv"],"mdk::param::Parameters::PerAcidData":[7,1,1,"_CPPv4I0EN3mdk5param10Parameters11PerAcidDataE"],"mdk::param::Parameters::PerAcidData::T":[7,8,1,"_CPPv4I0EN3mdk5param10Parameters11PerAcidDataE"],"mdk::param::Parameters::PerPTData":[7,1,1,"_CPPv4I0EN3mdk5param10Parameters9PerPTDataE"],"mdk::param::Parameters::PerPTData::T":[7,8,1,"_CPPv4I0EN3mdk5param10Parameters9PerPTDataE"],"mdk::param::Parameters::PerPairData":[7,1,1,"_CPPv4I0EN3mdk5param10Parameters11PerPairDataE"],"mdk::param::Parameters::PerPairData::T":[7,8,1,"_CPPv4I0EN3mdk5param10Parameters11PerPairDataE"],"mdk::param::Parameters::SpecificityParams":[7,2,1,"_CPPv4N3mdk5param10Parameters17SpecificityParamsE"],"mdk::param::Parameters::SpecificityParams::maxHydrophobicSS":[7,3,1,"_CPPv4N3mdk5param10Parameters17SpecificityParams16maxHydrophobicSSE"],"mdk::param::Parameters::SpecificityParams::maxPolarSS":[7,3,1,"_CPPv4N3mdk5param10Parameters17SpecificityParams10maxPolarSSE"],"mdk::param::Parameters::SpecificityParams::maxSidechain":[7,3,1,"_CPPv4N3mdk5param10Parameters17SpecificityParams12maxSidechainE"],"mdk::param::Parameters::SpecificityParams::polarization":[7,3,1,"_CPPv4N3mdk5param10Parameters17SpecificityParams12polarizationE"],"mdk::param::Parameters::angleParams":[7,3,1,"_CPPv4N3mdk5param10Parameters11angleParamsE"],"mdk::param::Parameters::defAngleParams":[7,3,1,"_CPPv4N3mdk5param10Parameters14defAngleParamsE"],"mdk::param::Parameters::dihedralParams":[7,3,1,"_CPPv4N3mdk5param10Parameters14dihedralParamsE"],"mdk::param::Parameters::mjMatrix":[7,3,1,"_CPPv4N3mdk5param10Parameters8mjMatrixE"],"mdk::param::Parameters::pairwiseMinDist":[7,3,1,"_CPPv4N3mdk5param10Parameters15pairwiseMinDistE"],"mdk::param::Parameters::radius":[7,3,1,"_CPPv4N3mdk5param10Parameters6radiusE"],"mdk::param::Parameters::specificity":[7,3,1,"_CPPv4N3mdk5param10Parameters11specificityE"],"mdk::param::Polarization":[2,7,1,"_CPPv4N3mdk5param12PolarizationE"],"mdk::param::Polarization::GLY_PRO":[2,4,1,"_CPPv4N3mdk5param12Polarization7GLY_PROE"],"mdk::param::Polarization::HYDROPHOBIC":[2,4,1,"_CPPv4N3mdk5param12Polarization11HYDROPHOBICE"],"mdk::param::Polarization::MISSING":[2,4,1,"_CPPv4N3mdk5param12Polarization7MISSINGE"],"mdk::param::Polarization::POLAR":[2,4,1,"_CPPv4N3mdk5param12Polarization5POLARE"],"mdk::param::Polarization::POLAR_NEG":[2,4,1,"_CPPv4N3mdk5param12Polarization9POLAR_NEGE"],"mdk::param::Polarization::POLAR_POS":[2,4,1,"_CPPv4N3mdk5param12Polarization9POLAR_POSE"],"mdk::pdb":[13,1,1,"_CPPv4N3mdk3pdbE"],"mdk::pdb::AtomParser":[13,2,1,"_CPPv4N3mdk3pdb10AtomParserE"],"mdk::pdb::AtomParser::AtomParser":[13,5,1,"_CPPv4N3mdk3pdb10AtomParser10AtomParserEv"],"mdk::pdb::Char":[8,2,1,"_CPPv4N3mdk3pdb4CharE"],"mdk::pdb::Char::Char":[8,5,1,"_CPPv4N3mdk3pdb4Char4CharEiRc"],"mdk::pdb::Char::Char::i":[8,6,1,"_CPPv4N3mdk3pdb4Char4CharEiRc"],"mdk::pdb::Char::Char::v":[8,6,1,"_CPPv4N3mdk3pdb4Char4CharEiRc"],"mdk::pdb::Char::i":[8,3,1,"_CPPv4N3mdk3pdb4Char1iE"],"mdk::pdb::Char::read":[8,5,1,"_CPPv4N3mdk3pdb4Char4readERKNSt6stringE"],"mdk::pdb::Char::read::s":[8,6,1,"_CPPv4N3mdk3pdb4Char4readERKNSt6stringE"],"mdk::pdb::Char::v":[8,3,1,"_CPPv4N3mdk3pdb4Char1vE"],"mdk::pdb::Char::write":[8,5,1,"_CPPv4NK3mdk3pdb4Char5writeERNSt6stringE"],"mdk::pdb::Char::write::s":[8,6,1,"_CPPv4NK3mdk3pdb4Char5writeERNSt6stringE"],"mdk::pdb::Cryst1Parser":[13,2,1,"_CPPv4N3mdk3pdb12Cryst1ParserE"],"mdk::pdb::Cryst1Parser::Cryst1Parser":[13,5,1,"_CPPv4N3mdk3pdb12Cryst1Parser12Cryst1ParserEv"],"mdk::pdb::Data":[12,2,1,"_CPPv4N3mdk3pdb4DataE"],"mdk::pdb::Data::Data":[12,5,1,"_CPPv4N3mdk3pdb4Data4DataEv"],"mdk::pdb::Data::Data::model":[12,6,1,"_CPPv4N3mdk3pdb4Data4DataERKN3pdb5ModelE"],"mdk::pdb::Data::asModel":[12,5,1,"_CPPv4NK3mdk3pdb4Data7asModelEv"],"mdk::pdb::Data::onlyAtoms":[12,5,1,"_CPPv4N3mdk3pdb4Data9onlyAtomsERKN3pdb5ModelE"],"mdk::pdb::Data::onlyAtoms::model":[12,6,1,"_CPPv4N3mdk3pdb4Data9onlyAtomsERKN3pdb5ModelE"],"mdk::pdb::Data::records":[12,3,1,"_CPPv4N3mdk3pdb4Data7recordsE"],"mdk::pdb::EndParser":[13,2,1,"_CPPv4N3mdk3pdb9EndParserE"],"mdk::pdb::EndParser::EndParser":[13,5,1,"_CPPv4N3mdk3pdb9EndParser9EndParserEv"],"mdk::pdb::EndmdlParser":[13,2,1,"_CPPv4N3mdk3pdb12EndmdlParserE"],"mdk::pdb::EndmdlParser::EndmdlParser":[13,5,1,"_CPPv4N3mdk3pdb12EndmdlParser12EndmdlParserEv"],"mdk::pdb::Exact":[2,4,1,"_CPPv4N3mdk3pdb4Mode5ExactE"],"mdk::pdb::Field":[8,2,1,"_CPPv4N3mdk3pdb5FieldE"],"mdk::pdb::Field::read":[8,5,1,"_CPPv4N3mdk3pdb5Field4readERKNSt6stringE"],"mdk::pdb::Field::read::s":[8,6,1,"_CPPv4N3mdk3pdb5Field4readERKNSt6stringE"],"mdk::pdb::Field::write":[8,5,1,"_CPPv4NK3mdk3pdb5Field5writeERNSt6stringE"],"mdk::pdb::Field::write::s":[8,6,1,"_CPPv4NK3mdk3pdb5Field5writeERNSt6stringE"],"mdk::pdb::HetatmParser":[13,2,1,"_CPPv4N3mdk3pdb12HetatmParserE"],"mdk::pdb::HetatmParser::HetatmParser":[13,5,1,"_CPPv4N3mdk3pdb12HetatmParser12HetatmParserEv"],"mdk::pdb::Integer":[8,2,1,"_CPPv4N3mdk3pdb7IntegerE"],"mdk::pdb::Integer::Integer":[8,5,1,"_CPPv4N3mdk3pdb7Integer7IntegerEiiRii"],"mdk::pdb::Integer::Integer::i":[8,6,1,"_CPPv4N3mdk3pdb7Integer7IntegerEiiRii"],"mdk::pdb::Integer::Integer::j":[8,6,1,"_CPPv4N3mdk3pdb7Integer7IntegerEiiRii"],"mdk::pdb::Integer::Integer::offset":[8,6,1,"_CPPv4N3mdk3pdb7Integer7IntegerEiiRii"],"mdk::pdb::Integer::Integer::v":[8,6,1,"_CPPv4N3mdk3pdb7Integer7IntegerEiiRii"],"mdk::pdb::Integer::i":[8,3,1,"_CPPv4N3mdk3pdb7Integer1iE"],"mdk::pdb::Integer::j":[8,3,1,"_CPPv4N3mdk3pdb7Integer1jE"],"mdk::pdb::Integer::offset":[8,3,1,"_CPPv4N3mdk3pdb7Integer6offsetE"],"mdk::pdb::Integer::read":[8,5,1,"_CPPv4N3mdk3pdb7Integer4readERKNSt6stringE"],"mdk::pdb::Integer::read::s":[8,6,1,"_CPPv4N3mdk3pdb7Integer4readERKNSt6stringE"],"mdk::pdb::Integer::v":[8,3,1,"_CPPv4N3mdk3pdb7Integer1vE"],"mdk::pdb::Integer::write":[8,5,1,"_CPPv4NK3mdk3pdb7Integer5writeERNSt6stringE"],"mdk::pdb::Integer::write::s":[8,6,1,"_CPPv4NK3mdk3pdb7Integer5writeERNSt6stringE"],"mdk::pdb::Left":[2,4,1,"_CPPv4N3mdk3pdb4Mode4LeftE"],"mdk::pdb::LinkParser":[13,2,1,"_CPPv4N3mdk3pdb10LinkParserE"],"mdk::pdb::LinkParser::LinkParser":[13,5,1,"_CPPv4N3mdk3pdb10LinkParser10LinkParserEv"],"mdk::pdb::Literal":[8,2,1,"_CPPv4N3mdk3pdb7LiteralE"],"mdk::pdb::Literal::Literal":[8,5,1,"_CPPv4N3mdk3pdb7Literal7LiteralEiiNSt6stringE"],"mdk::pdb::Literal::Literal::i":[8,6,1,"_CPPv4N3mdk3pdb7Literal7LiteralEiiNSt6stringE"],"mdk::pdb::Literal::Literal::j":[8,6,1,"_CPPv4N3mdk3pdb7Literal7LiteralEiiNSt6stringE"],"mdk::pdb::Literal::Literal::lit":[8,6,1,"_CPPv4N3mdk3pdb7Literal7LiteralEiiNSt6stringE"],"mdk::pdb::Literal::i":[8,3,1,"_CPPv4N3mdk3pdb7Literal1iE"],"mdk::pdb::Literal::j":[8,3,1,"_CPPv4N3mdk3pdb7Literal1jE"],"mdk::pdb::Literal::lit":[8,3,1,"_CPPv4N3mdk3pdb7Literal3litE"],"mdk::pdb::Literal::read":[8,5,1,"_CPPv4N3mdk3pdb7Literal4readERKNSt6stringE"],"mdk::pdb::Literal::read::s":[8,6,1,"_CPPv4N3mdk3pdb7Literal4readERKNSt6stringE"],"mdk::pdb::Literal::write":[8,5,1,"_CPPv4NK3mdk3pdb7Literal5writeERNSt6stringE"],"mdk::pdb::Literal::write::s":[8,6,1,"_CPPv4NK3mdk3pdb7Literal5writeERNSt6stringE"],"mdk::pdb::Mode":[8,7,1,"_CPPv4N3mdk3pdb4ModeE"],"mdk::pdb::Mode::Exact":[8,4,1,"_CPPv4N3mdk3pdb4Mode5ExactE"],"mdk::pdb::Mode::Left":[8,4,1,"_CPPv4N3mdk3pdb4Mode4LeftE"],"mdk::pdb::Mode::Right":[8,4,1,"_CPPv4N3mdk3pdb4Mode5RightE"],"mdk::pdb::Mode::Trim":[8,4,1,"_CPPv4N3mdk3pdb4Mode4TrimE"],"mdk::pdb::Model":[10,2,1,"_CPPv4N3mdk3pdb5ModelE"],"mdk::pdb::Model::Atom":[10,2,1,"_CPPv4N3mdk3pdb5Model4AtomE"],"mdk::pdb::Model::Atom::idxInRes":[10,3,1,"_CPPv4N3mdk3pdb5Model4Atom8idxInResE"],"mdk::pdb::Model::Atom::r":[10,3,1,"_CPPv4N3mdk3pdb5Model4Atom1rE"],"mdk::pdb::Model::Atom::res":[10,3,1,"_CPPv4N3mdk3pdb5Model4Atom3resE"],"mdk::pdb::Model::Atom::serial":[10,3,1,"_CPPv4N3mdk3pdb5Model4Atom6serialE"],"mdk::pdb::Model::Atom::type":[10,3,1,"_CPPv4N3mdk3pdb5Model4Atom4typeE"],"mdk::pdb::Model::Chain":[10,2,1,"_CPPv4N3mdk3pdb5Model5ChainE"],"mdk::pdb::Model::Chain::residues":[10,3,1,"_CPPv4N3mdk3pdb5Model5Chain8residuesE"],"mdk::pdb::Model::Chain::serial":[10,3,1,"_CPPv4N3mdk3pdb5Model5Chain6serialE"],"mdk::pdb::Model::Contact":[10,2,1,"_CPPv4N3mdk3pdb5Model7ContactE"],"mdk::pdb::Model::Contact::atom":[10,3,1,"_CPPv4N3mdk3pdb5Model7Contact4atomE"],"mdk::pdb::Model::Contact::dist0":[10,3,1,"_CPPv4N3mdk3pdb5Model7Contact5dist0E"],"mdk::pdb::Model::Contact::idx":[10,3,1,"_CPPv4N3mdk3pdb5Model7Contact3idxE"],"mdk::pdb::Model::Contact::type":[10,3,1,"_CPPv4N3mdk3pdb5Model7Contact4typeE"],"mdk::pdb::Model::Model":[10,5,1,"_CPPv4N3mdk3pdb5Model5ModelEv"],"mdk::pdb::Model::Model::coarse":[10,6,1,"_CPPv4N3mdk3pdb5Model5ModelERKN3mdk5ModelE"],"mdk::pdb::Model::Residue":[10,2,1,"_CPPv4N3mdk3pdb5Model7ResidueE"],"mdk::pdb::Model::Residue::atoms":[10,3,1,"_CPPv4N3mdk3pdb5Model7Residue5atomsE"],"mdk::pdb::Model::Residue::chain":[10,3,1,"_CPPv4N3mdk3pdb5Model7Residue5chainE"],"mdk::pdb::Model::Residue::find":[10,5,1,"_CPPv4N3mdk3pdb5Model7Residue4findERKNSt6stringE"],"mdk::pdb::Model::Residue::find::type":[10,6,1,"_CPPv4N3mdk3pdb5Model7Residue4findERKNSt6stringE"],"mdk::pdb::Model::Residue::idxInChain":[10,3,1,"_CPPv4N3mdk3pdb5Model7Residue10idxInChainE"],"mdk::pdb::Model::Residue::serial":[10,3,1,"_CPPv4N3mdk3pdb5Model7Residue6serialE"],"mdk::pdb::Model::Residue::type":[10,3,1,"_CPPv4N3mdk3pdb5Model7Residue4typeE"],"mdk::pdb::Model::addAtom":[10,5,1,"_CPPv4N3mdk3pdb5Model7addAtomEiP7Residue"],"mdk::pdb::Model::addAtom::res":[10,6,1,"_CPPv4N3mdk3pdb5Model7addAtomEiP7Residue"],"mdk::pdb::Model::addAtom::serial":[10,6,1,"_CPPv4N3mdk3pdb5Model7addAtomEiP7Residue"],"mdk::pdb::Model::addChain":[10,5,1,"_CPPv4N3mdk3pdb5Model8addChainEc"],"mdk::pdb::Model::addChain::serial":[10,6,1,"_CPPv4N3mdk3pdb5Model8addChainEc"],"mdk::pdb::Model::addContact":[10,5,1,"_CPPv4N3mdk3pdb5Model10addContactEv"],"mdk::pdb::Model::addContactsFromAtomOverlap":[10,5,1,"_CPPv4N3mdk3pdb5Model26addContactsFromAtomOverlapEv"],"mdk::pdb::Model::addContactsFromResOverlap":[10,5,1,"_CPPv4N3mdk3pdb5Model25addContactsFromResOverlapERKN5param10ParametersE"],"mdk::pdb::Model::addContactsFromResOverlap::params":[10,6,1,"_CPPv4N3mdk3pdb5Model25addContactsFromResOverlapERKN5param10ParametersE"],"mdk::pdb::Model::addResidue":[10,5,1,"_CPPv4N3mdk3pdb5Model10addResidueEiP5Chain"],"mdk::pdb::Model::addResidue::chain":[10,6,1,"_CPPv4N3mdk3pdb5Model10addResidueEiP5Chain"],"mdk::pdb::Model::addResidue::serial":[10,6,1,"_CPPv4N3mdk3pdb5Model10addResidueEiP5Chain"],"mdk::pdb::Model::atoms":[10,3,1,"_CPPv4N3mdk3pdb5Model5atomsE"],"mdk::pdb::Model::chains":[10,3,1,"_CPPv4N3mdk3pdb5Model6chainsE"],"mdk::pdb::Model::coarsen":[10,5,1,"_CPPv4N3mdk3pdb5Model7coarsenEv"],"mdk::pdb::Model::contacts":[10,3,1,"_CPPv4N3mdk3pdb5Model8contactsE"],"mdk::pdb::Model::residues":[10,3,1,"_CPPv4N3mdk3pdb5Model8residuesE"],"mdk::pdb::Model::top":[10,3,1,"_CPPv4N3mdk3pdb5Model3topE"],"mdk::pdb::ModelParser":[13,2,1,"_CPPv4N3mdk3pdb11ModelParserE"],"mdk::pdb::ModelParser::ModelParser":[13,5,1,"_CPPv4N3mdk3pdb11ModelParser11ModelParserEv"],"mdk::pdb::Parser":[12,2,1,"_CPPv4N3mdk3pdb6ParserE"],"mdk::pdb::Parser::Parser":[12,5,1,"_CPPv4N3mdk3pdb6Parser6ParserEv"],"mdk::pdb::Parser::parsers":[12,3,1,"_CPPv4N3mdk3pdb6Parser7parsersE"],"mdk::pdb::Parser::read":[12,5,1,"_CPPv4N3mdk3pdb6Parser4readERNSt7istreamE"],"mdk::pdb::Parser::read::is":[12,6,1,"_CPPv4N3mdk3pdb6Parser4readERNSt7istreamE"],"mdk::pdb::Parser::write":[12,5,1,"_CPPv4N3mdk3pdb6Parser5writeERNSt7ostreamERK4Data"],"mdk::pdb::Parser::write::data":[12,6,1,"_CPPv4N3mdk3pdb6Parser5writeERNSt7ostreamERK4Data"],"mdk::pdb::Parser::write::os":[12,6,1,"_CPPv4N3mdk3pdb6Parser5writeERNSt7ostreamERK4Data"],"mdk::pdb::Real":[8,2,1,"_CPPv4N3mdk3pdb4RealE"],"mdk::pdb::Real::Real":[8,5,1,"_CPPv4N3mdk3pdb4Real4RealEiiiiRdd"],"mdk::pdb::Real::Real::i":[8,6,1,"_CPPv4N3mdk3pdb4Real4RealEiiiiRdd"],"mdk::pdb::Real::Real::j":[8,6,1,"_CPPv4N3mdk3pdb4Real4RealEiiiiRdd"],"mdk::pdb::Real::Real::m":[8,6,1,"_CPPv4N3mdk3pdb4Real4RealEiiiiRdd"],"mdk::pdb::Real::Real::n":[8,6,1,"_CPPv4N3mdk3pdb4Real4RealEiiiiRdd"],"mdk::pdb::Real::Real::scalar":[8,6,1,"_CPPv4N3mdk3pdb4Real4RealEiiiiRdd"],"mdk::pdb::Real::Real::v":[8,6,1,"_CPPv4N3mdk3pdb4Real4RealEiiiiRdd"],"mdk::pdb::Real::i":[8,3,1,"_CPPv4N3mdk3pdb4Real1iE"],"mdk::pdb::Real::j":[8,3,1,"_CPPv4N3mdk3pdb4Real1jE"],"mdk::pdb::Real::m":[8,3,1,"_CPPv4N3mdk3pdb4Real1mE"],"mdk::pdb::Real::n":[8,3,1,"_CPPv4N3mdk3pdb4Real1nE"],"mdk::pdb::Real::read":[8,5,1,"_CPPv4N3mdk3pdb4Real4readERKNSt6stringE"],"mdk::pdb::Real::read::s":[8,6,1,"_CPPv4N3mdk3pdb4Real4readERKNSt6stringE"],"mdk::pdb::Real::scalar":[8,3,1,"_CPPv4N3mdk3pdb4Real6scalarE"],"mdk::pdb::Real::v":[8,3,1,"_CPPv4N3mdk3pdb4Real1vE"],"mdk::pdb::Real::write":[8,5,1,"_CPPv4NK3mdk3pdb4Real5writeERNSt6stringE"],"mdk::pdb::Real::write::s":[8,6,1,"_CPPv4NK3mdk3pdb4Real5writeERNSt6stringE"],"mdk::pdb::RecordParser":[13,2,1,"_CPPv4N3mdk3pdb12RecordParserE"],"mdk::pdb::RecordParser::fields":[13,3,1,"_CPPv4N3mdk3pdb12RecordParser6fieldsE"],"mdk::pdb::RecordParser::record":[13,3,1,"_CPPv4N3mdk3pdb12RecordParser6recordE"],"mdk::pdb::RecordParser::tryParse":[13,5,1,"_CPPv4NK3mdk3pdb12RecordParser8tryParseERKNSt6stringE"],"mdk::pdb::RecordParser::tryParse::s":[13,6,1,"_CPPv4NK3mdk3pdb12RecordParser8tryParseERKNSt6stringE"],"mdk::pdb::RecordParser::write":[13,5,1,"_CPPv4N3mdk3pdb12RecordParser5writeERNSt7ostreamERK6Record"],"mdk::pdb::RecordParser::write::os":[13,6,1,"_CPPv4N3mdk3pdb12RecordParser5writeERNSt7ostreamERK6Record"],"mdk::pdb::RecordParser::write::other":[13,6,1,"_CPPv4N3mdk3pdb12RecordParser5writeERNSt7ostreamERK6Record"],"mdk::pdb::RemarkParser":[13,2,1,"_CPPv4N3mdk3pdb12RemarkParserE"],"mdk::pdb::RemarkParser::RemarkParser":[13,5,1,"_CPPv4N3mdk3pdb12RemarkParser12RemarkParserEv"],"mdk::pdb::Right":[2,4,1,"_CPPv4N3mdk3pdb4Mode5RightE"],"mdk::pdb::SSBondParser":[13,2,1,"_CPPv4N3mdk3pdb12SSBondParserE"],"mdk::pdb::SSBondParser::SSBondParser":[13,5,1,"_CPPv4N3mdk3pdb12SSBondParser12SSBondParserEv"],"mdk::pdb::String":[8,2,1,"_CPPv4N3mdk3pdb6StringE"],"mdk::pdb::String::String":[8,5,1,"_CPPv4N3mdk3pdb6String6StringEiiRNSt6stringE6int8_t"],"mdk::pdb::String::String::i":[8,6,1,"_CPPv4N3mdk3pdb6String6StringEiiRNSt6stringE6int8_t"],"mdk::pdb::String::String::j":[8,6,1,"_CPPv4N3mdk3pdb6String6StringEiiRNSt6stringE6int8_t"],"mdk::pdb::String::String::mode":[8,6,1,"_CPPv4N3mdk3pdb6String6StringEiiRNSt6stringE6int8_t"],"mdk::pdb::String::String::v":[8,6,1,"_CPPv4N3mdk3pdb6String6StringEiiRNSt6stringE6int8_t"],"mdk::pdb::String::i":[8,3,1,"_CPPv4N3mdk3pdb6String1iE"],"mdk::pdb::String::j":[8,3,1,"_CPPv4N3mdk3pdb6String1jE"],"mdk::pdb::String::mode":[8,3,1,"_CPPv4N3mdk3pdb6String4modeE"],"mdk::pdb::String::read":[8,5,1,"_CPPv4N3mdk3pdb6String4readERKNSt6stringE"],"mdk::pdb::String::read::s":[8,6,1,"_CPPv4N3mdk3pdb6String4readERKNSt6stringE"],"mdk::pdb::String::v":[8,3,1,"_CPPv4N3mdk3pdb6String1vE"],"mdk::pdb::String::write":[8,5,1,"_CPPv4NK3mdk3pdb6String5writeERNSt6stringE"],"mdk::pdb::String::write::s":[8,6,1,"_CPPv4NK3mdk3pdb6String5writeERNSt6stringE"],"mdk::pdb::SymOp":[8,2,1,"_CPPv4N3mdk3pdb5SymOpE"],"mdk::pdb::SymOp::SymOp":[8,5,1,"_CPPv4N3mdk3pdb5SymOp5SymOpEiiRNSt6stringE"],"mdk::pdb::SymOp::SymOp::i":[8,6,1,"_CPPv4N3mdk3pdb5SymOp5SymOpEiiRNSt6stringE"],"mdk::pdb::SymOp::SymOp::j":[8,6,1,"_CPPv4N3mdk3pdb5SymOp5SymOpEiiRNSt6stringE"],"mdk::pdb::SymOp::SymOp::v":[8,6,1,"_CPPv4N3mdk3pdb5SymOp5SymOpEiiRNSt6stringE"],"mdk::pdb::SymOp::i":[8,3,1,"_CPPv4N3mdk3pdb5SymOp1iE"],"mdk::pdb::SymOp::j":[8,3,1,"_CPPv4N3mdk3pdb5SymOp1jE"],"mdk::pdb::SymOp::read":[8,5,1,"_CPPv4N3mdk3pdb5SymOp4readERKNSt6stringE"],"mdk::pdb::SymOp::read::s":[8,6,1,"_CPPv4N3mdk3pdb5SymOp4readERKNSt6stringE"],"mdk::pdb::SymOp::v":[8,3,1,"_CPPv4N3mdk3pdb5SymOp1vE"],"mdk::pdb::SymOp::write":[8,5,1,"_CPPv4NK3mdk3pdb5SymOp5writeERNSt6stringE"],"mdk::pdb::SymOp::write::s":[8,6,1,"_CPPv4NK3mdk3pdb5SymOp5writeERNSt6stringE"],"mdk::pdb::TerParser":[13,2,1,"_CPPv4N3mdk3pdb9TerParserE"],"mdk::pdb::TerParser::TerParser":[13,5,1,"_CPPv4N3mdk3pdb9TerParser9TerParserEv"],"mdk::pdb::Trim":[2,4,1,"_CPPv4N3mdk3pdb4Mode4TrimE"],"mdk::pdb::operator&lt;&lt;":[2,5,1,"_CPPv4N3mdk3pdblsER4DataRKN7records6RecordE"],"mdk::pdb::operator&lt;&lt;::data":[2,6,1,"_CPPv4N3mdk3pdblsER4DataRKN7records6RecordE"],"mdk::pdb::operator&lt;&lt;::other":[2,6,1,"_CPPv4N3mdk3pdblsER4DataRK4Data"],"mdk::pdb::operator&lt;&lt;::record":[2,6,1,"_CPPv4N3mdk3pdblsER4DataRKN7records6RecordE"],"mdk::pdb::records":[14,1,1,"_CPPv4N3mdk3pdb7recordsE"],"mdk::pdb::records::Atom":[14,2,1,"_CPPv4N3mdk3pdb7records4AtomE"],"mdk::pdb::records::Atom::altLocation":[14,3,1,"_CPPv4N3mdk3pdb7records4Atom11altLocationE"],"mdk::pdb::records::Atom::atomName":[14,3,1,"_CPPv4N3mdk3pdb7records4Atom8atomNameE"],"mdk::pdb::records::Atom::chainID":[14,3,1,"_CPPv4N3mdk3pdb7records4Atom7chainIDE"],"mdk::pdb::records::Atom::charge":[14,3,1,"_CPPv4N3mdk3pdb7records4Atom6chargeE"],"mdk::pdb::records::Atom::element":[14,3,1,"_CPPv4N3mdk3pdb7records4Atom7elementE"],"mdk::pdb::records::Atom::insertionCode":[14,3,1,"_CPPv4N3mdk3pdb7records4Atom13insertionCodeE"],"mdk::pdb::records::Atom::occupancy":[14,3,1,"_CPPv4N3mdk3pdb7records4Atom9occupancyE"],"mdk::pdb::records::Atom::pos":[14,3,1,"_CPPv4N3mdk3pdb7records4Atom3posE"],"mdk::pdb::records::Atom::residueName":[14,3,1,"_CPPv4N3mdk3pdb7records4Atom11residueNameE"],"mdk::pdb::records::Atom::residueSeqNum":[14,3,1,"_CPPv4N3mdk3pdb7records4Atom13residueSeqNumE"],"mdk::pdb::records::Atom::serialNum":[14,3,1,"_CPPv4N3mdk3pdb7records4Atom9serialNumE"],"mdk::pdb::records::Atom::tempFactor":[14,3,1,"_CPPv4N3mdk3pdb7records4Atom10tempFactorE"],"mdk::pdb::records::Cryst1":[14,2,1,"_CPPv4N3mdk3pdb7records6Cryst1E"],"mdk::pdb::records::Cryst1::angles":[14,3,1,"_CPPv4N3mdk3pdb7records6Cryst16anglesE"],"mdk::pdb::records::Cryst1::size":[14,3,1,"_CPPv4N3mdk3pdb7records6Cryst14sizeE"],"mdk::pdb::records::Cryst1::spaceGroup":[14,3,1,"_CPPv4N3mdk3pdb7records6Cryst110spaceGroupE"],"mdk::pdb::records::Cryst1::z":[14,3,1,"_CPPv4N3mdk3pdb7records6Cryst11zE"],"mdk::pdb::records::End":[14,2,1,"_CPPv4N3mdk3pdb7records3EndE"],"mdk::pdb::records::Endmdl":[14,2,1,"_CPPv4N3mdk3pdb7records6EndmdlE"],"mdk::pdb::records::Link":[14,2,1,"_CPPv4N3mdk3pdb7records4LinkE"],"mdk::pdb::records::Link::PerResidueData":[14,2,1,"_CPPv4N3mdk3pdb7records4Link14PerResidueDataE"],"mdk::pdb::records::Link::PerResidueData::altLocation":[14,3,1,"_CPPv4N3mdk3pdb7records4Link14PerResidueData11altLocationE"],"mdk::pdb::records::Link::PerResidueData::atomName":[14,3,1,"_CPPv4N3mdk3pdb7records4Link14PerResidueData8atomNameE"],"mdk::pdb::records::Link::PerResidueData::chainId":[14,3,1,"_CPPv4N3mdk3pdb7records4Link14PerResidueData7chainIdE"],"mdk::pdb::records::Link::PerResidueData::insertionCode":[14,3,1,"_CPPv4N3mdk3pdb7records4Link14PerResidueData13insertionCodeE"],"mdk::pdb::records::Link::PerResidueData::residueName":[14,3,1,"_CPPv4N3mdk3pdb7records4Link14PerResidueData11residueNameE"],"mdk::pdb::records::Link::PerResidueData::residueSeqNum":[14,3,1,"_CPPv4N3mdk3pdb7records4Link14PerResidueData13residueSeqNumE"],"mdk::pdb::records::Link::PerResidueData::symmetryOp":[14,3,1,"_CPPv4N3mdk3pdb7records4Link14PerResidueData10symmetryOpE"],"mdk::pdb::records::Link::linkLength":[14,3,1,"_CPPv4N3mdk3pdb7records4Link10linkLengthE"],"mdk::pdb::records::Link::res":[14,3,1,"_CPPv4N3mdk3pdb7records4Link3resE"],"mdk::pdb::records::Model":[14,2,1,"_CPPv4N3mdk3pdb7records5ModelE"],"mdk::pdb::records::Model::serialNum":[14,3,1,"_CPPv4N3mdk3pdb7records5Model9serialNumE"],"mdk::pdb::records::Record":[14,1,1,"_CPPv4N3mdk3pdb7records6RecordE"],"mdk::pdb::records::Remark":[14,2,1,"_CPPv4N3mdk3pdb7records6RemarkE"],"mdk::pdb::records::Remark::number":[14,3,1,"_CPPv4N3mdk3pdb7records6Remark6numberE"],"mdk::pdb::records::Remark::text":[14,3,1,"_CPPv4N3mdk3pdb7records6Remark4textE"],"mdk::pdb::records::SSBond":[14,2,1,"_CPPv4N3mdk3pdb7records6SSBondE"],"mdk::pdb::records::SSBond::PerResidueData":[14,2,1,"_CPPv4N3mdk3pdb7records6SSBond14PerResidueDataE"],"mdk::pdb::records::SSBond::PerResidueData::chainId":[14,3,1,"_CPPv4N3mdk3pdb7records6SSBond14PerResidueData7chainIdE"],"mdk::pdb::records::SSBond::PerResidueData::insertionCode":[14,3,1,"_CPPv4N3mdk3pdb7records6SSBond14PerResidueData13insertionCodeE"],"mdk::pdb::records::SSBond::PerResidueData::residueSeqNum":[14,3,1,"_CPPv4N3mdk3pdb7records6SSBond14PerResidueData13residueSeqNumE"],"mdk::pdb::records::SSBond::PerResidueData::symmetryOp":[14,3,1,"_CPPv4N3mdk3pdb7records6SSBond14PerResidueData10symmetryOpE"],"mdk::pdb::records::SSBond::dist0":[14,3,1,"_CPPv4N3mdk3pdb7records6SSBond5dist0E"],"mdk::pdb::records::SSBond::res":[14,3,1,"_CPPv4N3mdk3pdb7records6SSBond3resE"],"mdk::pdb::records::SSBond::serialNum":[14,3,1,"_CPPv4N3mdk3pdb7records6SSBond9serialNumE"],"mdk::pdb::records::Ter":[14,2,1,"_CPPv4N3mdk3pdb7records3TerE"],"mdk::pdb::records::Ter::chainId":[14,3,1,"_CPPv4N3mdk3pdb7records3Ter7chainIdE"],"mdk::pdb::records::Ter::insertionCode":[14,3,1,"_CPPv4N3mdk3pdb7records3Ter13insertionCodeE"],"mdk::pdb::records::Ter::residueName":[14,3,1,"_CPPv4N3mdk3pdb7records3Ter11residueNameE"],"mdk::pdb::records::Ter::residueSeqNum":[14,3,1,"_CPPv4N3mdk3pdb7records3Ter13residueSeqNumE"],"mdk::pdb::records::Ter::serialNum":[14,3,1,"_CPPv4N3mdk3pdb7records3Ter9serialNumE"],"mdk::rad":[57,3,1,"_CPPv4N3mdk3radE"],"mdk::rtrim":[2,5,1,"_CPPv4N3mdk5rtrimENSt11string_viewE"],"mdk::rtrim::s":[2,6,1,"_CPPv4N3mdk5rtrimENSt11string_viewE"],"mdk::second":[57,3,1,"_CPPv4N3mdk6secondE"],"mdk::seq":[2,1,1,"_CPPv4N3mdk3seqE"],"mdk::seq::LegacyParser":[15,2,1,"_CPPv4N3mdk3seq12LegacyParserE"],"mdk::seq::LegacyParser::read":[15,5,1,"_CPPv4N3mdk3seq12LegacyParser4readERKNSt10filesystem4pathE"],"mdk::seq::LegacyParser::read::path":[15,6,1,"_CPPv4N3mdk3seq12LegacyParser4readERKNSt10filesystem4pathE"],"mdk::seq::Sequence":[15,2,1,"_CPPv4N3mdk3seq8SequenceE"],"mdk::seq::Sequence::Chain":[15,2,1,"_CPPv4N3mdk3seq8Sequence5ChainE"],"mdk::seq::Sequence::Chain::codes":[15,3,1,"_CPPv4N3mdk3seq8Sequence5Chain5codesE"],"mdk::seq::Sequence::Chain::contactMaps":[15,3,1,"_CPPv4N3mdk3seq8Sequence5Chain11contactMapsE"],"mdk::seq::Sequence::asModel":[15,5,1,"_CPPv4NK3mdk3seq8Sequence7asModelEv"],"mdk::seq::Sequence::chains":[15,3,1,"_CPPv4N3mdk3seq8Sequence6chainsE"],"mdk::seq::Sequence::contactMaps":[15,3,1,"_CPPv4N3mdk3seq8Sequence11contactMapsE"],"mdk::seq::Sequence::screeningDist":[15,3,1,"_CPPv4N3mdk3seq8Sequence13screeningDistE"],"mdk::skipLine":[2,5,1,"_CPPv4N3mdk8skipLineERNSt7istreamE"],"mdk::skipLine::is":[2,6,1,"_CPPv4N3mdk8skipLineERNSt7istreamE"],"mdk::tau":[57,3,1,"_CPPv4N3mdk3tauE"],"mdk::trim":[2,5,1,"_CPPv4N3mdk4trimENSt11string_viewE"],"mdk::trim::s":[2,6,1,"_CPPv4N3mdk4trimENSt11string_viewE"],"mdk::view":[2,5,1,"_CPPv4N3mdk4viewERKNSt6stringEii"],"mdk::view::i":[2,6,1,"_CPPv4N3mdk4viewERKNSt6stringEii"],"mdk::view::j":[2,6,1,"_CPPv4N3mdk4viewERKNSt6stringEii"],"mdk::view::s":[2,6,1,"_CPPv4N3mdk4viewERKNSt6stringEii"],"mdk::vl":[2,1,1,"_CPPv4N3mdk2vlE"],"mdk::vl::List":[48,2,1,"_CPPv4N3mdk2vl4ListE"],"mdk::vl::List::bind":[48,5,1,"_CPPv4N3mdk2vl4List4bindER10Simulation"],"mdk::vl::List::bind::simulation":[48,6,1,"_CPPv4N3mdk2vl4List4bindER10Simulation"],"mdk::vl::List::chains":[48,3,1,"_CPPv4N3mdk2vl4List6chainsE"],"mdk::vl::List::check":[48,5,1,"_CPPv4N3mdk2vl4List5checkEv"],"mdk::vl::List::cutoff":[48,3,1,"_CPPv4N3mdk2vl4List6cutoffE"],"mdk::vl::List::effCutoff":[48,3,1,"_CPPv4N3mdk2vl4List9effCutoffE"],"mdk::vl::List::effCutoffSq":[48,3,1,"_CPPv4N3mdk2vl4List11effCutoffSqE"],"mdk::vl::List::first":[48,3,1,"_CPPv4N3mdk2vl4List5firstE"],"mdk::vl::List::forces":[48,3,1,"_CPPv4N3mdk2vl4List6forcesE"],"mdk::vl::List::grid":[48,3,1,"_CPPv4N3mdk2vl4List4gridE"],"mdk::vl::List::indexOf":[48,5,1,"_CPPv4N3mdk2vl4List7indexOfERKN5Eigen8Vector3iE"],"mdk::vl::List::indexOf::loc":[48,6,1,"_CPPv4N3mdk2vl4List7indexOfERKN5Eigen8Vector3iE"],"mdk::vl::List::initial":[48,3,1,"_CPPv4N3mdk2vl4List7initialE"],"mdk::vl::List::last":[48,3,1,"_CPPv4N3mdk2vl4List4lastE"],"mdk::vl::List::minBondSep":[48,3,1,"_CPPv4N3mdk2vl4List10minBondSepE"],"mdk::vl::List::needToReset":[48,5,1,"_CPPv4NK3mdk2vl4List11needToResetEv"],"mdk::vl::List::next":[48,3,1,"_CPPv4N3mdk2vl4List4nextE"],"mdk::vl::List::pad":[48,3,1,"_CPPv4N3mdk2vl4List3padE"],"mdk::vl::List::pairs":[48,3,1,"_CPPv4N3mdk2vl4List5pairsE"],"mdk::vl::List::perCell":[48,5,1,"_CPPv4N3mdk2vl4List7perCellEi"],"mdk::vl::List::perCell::c1":[48,6,1,"_CPPv4N3mdk2vl4List7perCellEi"],"mdk::vl::List::perPair":[48,5,1,"_CPPv4N3mdk2vl4List7perPairEii"],"mdk::vl::List::perPair::c1":[48,6,1,"_CPPv4N3mdk2vl4List7perPairEii"],"mdk::vl::List::perPair::c2":[48,6,1,"_CPPv4N3mdk2vl4List7perPairEii"],"mdk::vl::List::r0":[48,3,1,"_CPPv4N3mdk2vl4List2r0E"],"mdk::vl::List::registerNF":[48,5,1,"_CPPv4N3mdk2vl4List10registerNFER13NonlocalForceRK4Spec"],"mdk::vl::List::registerNF::force":[48,6,1,"_CPPv4N3mdk2vl4List10registerNFER13NonlocalForceRK4Spec"],"mdk::vl::List::registerNF::spec":[48,6,1,"_CPPv4N3mdk2vl4List10registerNFER13NonlocalForceRK4Spec"],"mdk::vl::List::state":[48,3,1,"_CPPv4N3mdk2vl4List5stateE"],"mdk::vl::List::t0":[48,3,1,"_CPPv4N3mdk2vl4List2t0E"],"mdk::vl::List::top0":[48,3,1,"_CPPv4N3mdk2vl4List4top0E"],"mdk::vl::List::update":[48,5,1,"_CPPv4N3mdk2vl4List6updateEv"],"mdk::vl::List::updateGrid":[48,5,1,"_CPPv4N3mdk2vl4List10updateGridEv"],"mdk::vl::PairInfo":[2,2,1,"_CPPv4N3mdk2vl8PairInfoE"],"mdk::vl::PairInfo::i1":[2,3,1,"_CPPv4N3mdk2vl8PairInfo2i1E"],"mdk::vl::PairInfo::i2":[2,3,1,"_CPPv4N3mdk2vl8PairInfo2i2E"],"mdk::vl::PairInfo::norm":[2,3,1,"_CPPv4N3mdk2vl8PairInfo4normE"],"mdk::vl::PairInfo::unit":[2,3,1,"_CPPv4N3mdk2vl8PairInfo4unitE"],"mdk::vl::Spec":[48,2,1,"_CPPv4N3mdk2vl4SpecE"],"mdk::vl::Spec::cutoffSq":[48,3,1,"_CPPv4N3mdk2vl4Spec8cutoffSqE"],"mdk::vl::Spec::minBondSep":[48,3,1,"_CPPv4N3mdk2vl4Spec10minBondSepE"],"std::PhonyNameDueToError::operator()":[55,5,1,"_CPPv4NKSt19PhonyNameDueToErrorclERKN3mdk7ResTypeE"],"std::PhonyNameDueToError::operator()::aminoAcid":[50,6,1,"_CPPv4NKSt19PhonyNameDueToErrorclERKN3mdk9AminoAcidE"],"std::PhonyNameDueToError::operator()::resType":[55,6,1,"_CPPv4NKSt19PhonyNameDueToErrorclERKN3mdk7ResTypeE"],"std::hash&lt;mdk::AminoAcid&gt;":[50,2,1,"_CPPv4IENSt4hashIN3mdk9AminoAcidEEE"],"std::hash&lt;mdk::AminoAcid&gt;::operator()":[50,5,1,"_CPPv4NKSt4hashIN3mdk9AminoAcidEEclERKN3mdk9AminoAcidE"],"std::hash&lt;mdk::AminoAcid&gt;::operator()::aminoAcid":[50,6,1,"_CPPv4NKSt4hashIN3mdk9AminoAcidEEclERKN3mdk9AminoAcidE"],"std::hash&lt;mdk::ContactType&gt;":[51,2,1,"_CPPv4IENSt4hashIN3mdk11ContactTypeEEE"],"std::hash&lt;mdk::ContactType&gt;::operator()":[51,5,1,"_CPPv4NKSt4hashIN3mdk11ContactTypeEEclERKN3mdk11ContactTypeE"],"std::hash&lt;mdk::ContactType&gt;::operator()::resType":[51,6,1,"_CPPv4NKSt4hashIN3mdk11ContactTypeEEclERKN3mdk11ContactTypeE"],"std::hash&lt;mdk::ResType&gt;":[55,2,1,"_CPPv4IENSt4hashIN3mdk7ResTypeEEE"],"std::hash&lt;mdk::ResType&gt;::operator()":[55,5,1,"_CPPv4NKSt4hashIN3mdk7ResTypeEEclERKN3mdk7ResTypeE"],"std::hash&lt;mdk::ResType&gt;::operator()::resType":[55,6,1,"_CPPv4NKSt4hashIN3mdk7ResTypeEEclERKN3mdk7ResTypeE"],Unit:[57,0,1,"c.Unit"],mdk:[57,1,1,"_CPPv43mdk"],std:[55,1,1,"_CPPv4St"]}},objnames:{"0":["c","macro","C macro"],"1":["cpp","type","C++ type"],"2":["cpp","class","C++ class"],"3":["cpp","member","C++ member"],"4":["cpp","enumerator","C++ enumerator"],"5":["cpp","function","C++ function"],"6":["cpp","functionParam","C++ function parameter"],"7":["cpp","enum","C++ enum"],"8":["cpp","templateParam","C++ template parameter"]},objtypes:{"0":"c:macro","1":"cpp:type","2":"cpp:class","3":"cpp:member","4":"cpp:enumerator","5":"cpp:function","6":"cpp:functionParam","7":"cpp:enum","8":"cpp:templateParam"},terms:{"0":[2,6,8,10,14,18,19,20,21,22,23,25,27,28,29,30,31,35,36,37,38,40,41,42,44,45,47,48,54,57],"005":[2,37],"016":[2,40],"02214076e23":[2,57],"06225":[2,40],"0e3":[2,57],"0e6":[2,57],"0e9":[2,57],"1":[2,4,6,7,8,10,14,18,19,20,21,22,23,27,28,29,30,40,41,42,43,47,48,54,57],"10":[2,22,28,41,48,57],"1000":[2,30],"19":[2,57],"1e":[2,6],"2":[2,4,6,7,10,14,18,19,20,21,27,28,36,38,40,47,48,54,57],"20":[2,50],"23":[2,57],"25663706212e":[2,57],"299792458":[2,57],"3":[2,6,18,21,27,29,43,48,56,57],"30":[2,19],"33":[2,21],"35":[2,36],"360":[2,57],"380649e":[2,57],"4":[2,6,18,22,27,42],"4184":[2,57],"5":[2,28,40,44,57],"50":[2,38],"56":[2,6],"57824959":[2,57],"6":[2,14,19,21,27,28,57],"602176634e":[2,57],"66":[2,21],"70":[2,33],"75":[2,28],"8":[2,6,28,29],"80":[2,22],"9":[2,53],"90":[2,14],"92":[2,28],"99999999965e":[2,57],"abstract":[2,24],"break":[2,28],"byte":[2,18,19,20,21,29,43],"case":[2,10,14,19,21,44],"char":[2,8,10,14,50],"class":[0,2,4,6,7,8,10,11,12,13,14,15,16,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,35,36,37,38,39,40,41,42,43,44,45,46,47,48,52,54],"const":[2,4,6,7,8,10,12,13,15,16,18,19,21,22,23,24,25,26,27,28,30,32,38,40,41,42,43,44,46,47,48,50,51,53,54,55,56],"default":[2,6,7,8,10,12,18,29,38,40,41,42,43,44,48,50,51,54,55],"do":[2,23],"enum":[2,8,28,43,47,50,51,53,55],"export":[2,3,31,34],"final":[2,8,10],"float":[2,8],"function":[2,4,6,7,8,10,12,13,15,16,18,19,20,21,22,23,24,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,50,51,53,54,55,56],"int":[2,4,6,7,8,10,12,14,18,19,21,22,23,28,29,30,31,32,33,43,44,46,47,48,50,53,54],"long":[2,18],"new":[2,8,9,10,28],"pawe\u0142":0,"public":[2,4,6,7,8,10,12,13,14,15,16,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,35,36,37,38,40,41,42,43,44,45,46,47,48,50,51,54,55,56],"return":[2,4,6,7,10,12,13,15,16,18,22,23,25,26,27,28,40,43,44,47,48,50],"short":[2,48],"static":[2,12,19,44,50],"switch":57,"throw":[2,8],"true":[2,6,18,27,28,43,50],"try":[2,13,28],"var":[2,44],"void":[2,6,8,10,16,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,35,36,37,38,40,41,42,44,45,46,47,48,56],"while":[2,28],A:[2,4,6,7,8,10,11,12,13,14,15,16,18,19,20,21,22,23,24,25,26,27,28,29,30,32,33,42,43,44,45,48,50,51,53,54,55],As:[2,8,10,47],At:[2,3,8,55],By:[2,6,8],For:[2,3,14,17,19,40],If:[2,9,13,44,48],In:[2,8,9,11,12,21,25,28,41,48,56,57],It:[2,6,8,16,18,20,22,23,25,27,29,47,57],One:3,The:[2,5,6,8,11,18,19,20,21,24,25,27,28,29,30,38,40,41,42,43,44,48],There:9,These:[2,7],a_prev:[2,37],aaatominfo:[2,50],abil:[2,13],abl:[2,38,40,41,42],about:2,academi:0,access:[2,28,43,44],accomod:[2,48],accord:[2,48],account:[2,6,28],accur:[2,27],acid1:[2,53],acid2:[2,53],acid:[0,2,7,10,12,15,27,28,47,52,55],across:[2,6,28],action:[2,22,23,25,26,27,28,31,44],activ:[2,28,31,33],actual:[2,24,26,28],ad:[2,8,9,10,12,22,23,24,25,28,44,48],add:[2,3,9,10,11,12,19,20,21,22,23,24,26,27,28,29,38,40,41,42,44,48,54,55],addasynctask:[2,44],addatom:[2,10],addchain:[2,6,10],addcmapcontact:[2,6],addcontact:[2,6,10],addcontactmap:[2,6],addcontactsfromatomoverlap:[2,10],addcontactsfromresoverlap:[2,10],addit:[2,24,44,47],addition:[2,29],addresidu:[2,6,10],addsp:[2,6],adiabat:[2,23,24,27,34],adjust:[2,35,48,56],advanc:[2,44],after:[2,9,28,30,31,35,44],agre:[2,44],ala:[2,50,55],algebra:[2,27],algorithm:[2,37],align:[2,8],all:[2,6,18,23,25,28],allcontact:[2,23],alloc:[2,23,28],allow:[2,8,9,16,48,50,51,55],almost:39,along:[2,6,8,50,51,55],alpha:[2,27],alphanumer:[2,10],also:[2,3,6,9,10,17,23,27,30,32,43,47,57],altern:[2,27],although:[2,48],altloc:[2,14],alwai:[2,30,38],amino:[0,2,7,10,12,15,27,28,47,52,55],aminoacid:[2,7,15,27,28,50,53,57],aminoacididx:[2,50],aminoacidinfo:[2,50],aminoacidradii:[2,10],among:[2,48],amper:[2,57],amplitud:[2,20],an:[2,6,7,8,9,10,11,12,13,15,18,19,21,22,24,25,26,27,28,33,35,36,37,38,40,41,42,43,44,45,46,47,48,50,51,55,56,57],angl:[2,4,6,7,14,18,24,27,34],angleparam:[2,7],angletyp:[2,19,21],angstrem:[2,6,29],angstrom:[2,6,22,28,38,40,41,42,48,57],anharmon:[2,38],ani:[2,3,5,6,10,28],annoi:[2,43],anoth:[2,12,28],appar:[2,36],appear:39,append:[2,12],appli:[2,11,19,21],appropri:[2,5,39,43,44],approxim:[2,10],ar:[2,4,6,7,8,9,10,12,13,15,16,17,18,22,23,25,27,28,29,30,36,38,39,40,41,42,44,48,57],arg:[2,44,50,55],arguabl:[2,7],argument:[2,27,44],arrai:[2,6,18,27,28,43,47],asid:[2,54],asmodel:[2,12,15],asn:[2,50,55],asp:[2,50,55],aspher:2,associ:[2,4,15,18,19,21,44,48],assum:[2,6,7,15,32],async:[2,44],asynchron:[2,19,20,21,22,23,24,26,27,28,29],asyncpart:[2,19,20,21,22,23,24,26,27,28,29],asynctask:[2,44],atom:[2,5,6,7,8,9,12,14,50,55,57],atominfo:[2,50],atomnam:[2,14],atompars:[2,13],attribut:[2,13,19,21,22,24,25,35,50],au:[2,57],author:0,auto:[2,43],avail:[2,47],averag:[2,57],avoid:[2,6,23],b:[2,23,54],back:[2,8],backbon:[2,10,15,28,47],bar:[2,31,34],base:[0,2,10,13,16,21,22,30,43],bb:[2,27,28,47],bb_lj:[2,28],bb_neg:[2,27],bb_neg_lj:[2,27],bb_po:[2,27],bb_pos_lj:[2,27],becaus:[2,6,10,13,25,29,33,36],bednarz:0,been:[2,10,25,28,35,44],befor:[2,28],begin:[2,4,8],behavior:[2,6],behind:[2,48],being:[2,6,25],belong:[2,6,10],benefit:[2,22],between:[2,7,18,19,21,22,27,28,29,30,38,40,41,42,47,48,56],betwen:[2,30],bidirection:[2,13],bind:[2,19,20,21,22,23,24,25,26,27,28,29,30,32,33,35,36,37,44,45,46,47,48],boguta:0,bond:[2,4,6,7,18,20,24,27,29,34,48],bondangl:[2,19,24],bool:[2,6,18,27,28,29,36,44,47,48,50,56],both:[2,19,41],bound:[2,25,41,45],box:[2,6,10,13,46,48,56],breakingtim:[2,28],breakingtoler:[2,28],broken:[2,28],bs:[2,28,47],bs_lj:[2,28],bsc:0,buffer:[2,48],bug:[2,36,57],c1:[2,48],c2:[2,48],c_i:[2,20],c_nat:[2,20],ca:[2,10],calcforc:[2,44],call:[2,47,48],can:[2,3,5,7,9,13,16,24,28,45,47],cannot:[2,22,28,44,46],captur:[2,44],care:[2,33,39,44],cba:[2,19],cda:[2,21],cdb:[2,21],cdh:[2,21],cell:[2,12,48,56],cellinv:[2,56],center:[2,27],certain:[2,12,24],cg:[2,10],chain:[2,4,6,10,12,15,16,18,19,20,24,27,28,34,48],chainid:[2,14],chainidx:[2,6,18],chang:[2,4,27],charact:[2,8,10,33],charg:[2,14,16,18,22],check:[2,6,18,22,27,28,30,47,48,50],chief:[2,43],chiefli:[2,8,10,16,25,28,33,42,43],chiral:[2,24,34],chrono:[2,33],clariti:[2,6],clear:[2,6,57],clock:[2,33],cmake:3,cmakelist:3,cmap:[2,4,6,15],coars:[0,2,10],coarsen:[2,10],code:[2,6,15,36,50,51,55,57],coeff:[2,7,19,21],coeffici:[2,19,21],col:[2,43],collaps:[2,10],collect:[2,11,44],colmajor:[2,43],combin:[2,8,36],common:[2,21],compar:[2,8,32,47],comparison:[2,40,48],compil:[2,19,21,38,47],complex:[2,9,21],complexnativedihedr:[2,21],compon:9,compos:[2,21],compris:[2,10,13,15],comput:[2,18,20,21,22,23,24,25,26,27,28,29,35,38,39,40,41,42,48,56],computation:[2,27],computef:[2,38,40,41,42],computenh:[2,28],computev:[2,38,40,41,42],concurr:[2,28],confirm:[2,57],conflict:[2,28],conform:[2,6,12],connect:[2,10,19,20,23,29],consecut:[2,10,12,29,30,32],consid:[2,6],constant:[2,22,43,48],constdh:[2,22],constexpr:[2,19,50,51,53,55,57],constitu:[2,10,43],construct:[2,10,16,17,29,30,33,44],constructor:[2,11,16],cont:[2,28],contact:[0,2,5,6,7,10,12,15,22,24,25,28,30,34,47,52],contactmap:[2,4,6,15],contacttyp:[2,6,51],contacttypeidx:[2,51],contain:[2,6,10,12,14,16,18,19,30,43,46,47,48,57],conveni:[2,16,17,29,33],convent:[2,8,18],convers:[2,9,50,51,55],convert:[2,8,9,12],coordin:[0,2,34],copi:[2,10,23,25,26,27,43],correct:2,correctli:[2,6],corrector:[2,34,35],correspond:[2,27,43,50],cosin:[2,27],cosinevers:[2,27],cost:[2,39,48],could:[2,7,15,28,48],coulomb:[2,57],cpc14:[2,18,28,41],cpp:[2,16,19,21],creat:[2,6,15,16,18,19,21,25,32,43,44,47],creation:[2,6],creationdiff:[2,47],cryst1:[2,12,14],cryst1pars:[2,13],cspeed:[2,57],cube:[2,20],cuber2460:46,curpair:[2,23],current:[2,6,28,30,32,33,38,46,48],custom:[2,6,9,24,34],cut:[2,40],cutoff:[2,23,25,27,40,41,42,48],cutoffsq:[2,48],cy:[2,50,55],cystein:[2,50],d0_cube_inv:[2,20],d:[2,19,27],d_0:[2,20],data:[0,2,4,5,7,9,10,11,23,25,27,28,29,30,34,43,44,50],datafactori:[2,16,44],deal:[2,43],deby:[2,22],decid:[2,28,57],declar:[2,24],decor:[2,43],decreas:[2,28],defangleparam:[2,7],defin:[2,10,16,19,21,27,28,31,57],definit:[0,2,18,38,52],degener:[2,10],degre:[2,14,18,19,57],denot:[2,4,14],densiti:[2,6],depend:[2,7,8,19,22,44],deprec:[2,38],depth:[2,7,23,28,40,41,42],deriv:[2,6,7,9,10,11,16,17,18,19,21,22,25,27,29,38,40,41,42],deriveangl:[2,27],describ:[2,4,7,41],design:11,destroi:[2,28],destruct:[2,16],destructor:[2,30],detail:[2,8,9,11,22,27,28],determin:[2,28,29,44],develop:0,df:[2,44],diff:[2,28,31,34,47],differ:[2,6,8,25,38,43,47],difficult:[2,6],dihedr:[2,4,6,7,18,20,24,34],dihedralangl:[2,21,24],dihedralparam:[2,7],dimens:[2,48],directori:46,displac:[2,38],displai:[2,33],dissip:[2,28],dist0:[2,4,6,10,14,29],distanc:[2,6,15,18,22,23,25,27,28,29,40,41,42,48,56,57],distinct:[2,44],distinguish:[2,53],distribut:[2,7],divid:[2,8],dl_dpsi:[2,27],doc:[2,8,46],document:0,doe:[2,48],doesn:[2,3,4,6,10],don:[2,28],done:[2,28],doubl:[2,4,6,7,8,10,14,15,19,20,21,22,23,27,28,30,33,36,37,38,40,41,42,43,44,46,48,50,54,55],doxygen:46,doxygenclass:46,dpsi_dr:[2,27],dspi_dr:[2,27],dt:[2,36,37],due:[2,18],duplic:[2,15],dure:[0,2,6,28],dv_dn:[2,40,41,42],dv_dphi:[2,21],dv_dth:[2,19],dv_dx:[2,38],dx:[2,38],dyn:[2,46],dynam:[2,19,20,21,22,23,24,26,27,28,29,43,46],e:[2,4,6,9,10,12,15,16,19,20,21,22,25,27,28,29,30,31,32,38,41,43,44,45,46,48],e_chi:[2,20],each:[2,6,7,16,21,22,27,28,47,48],easier:[2,8,57],easili:[2,43],echarg:[2,22,57],effcutoff:[2,48],effcutoffsq:[2,48],effect:[2,44],eigen:[2,10,14,21,22,38,40,41,42,43,48,54],either:[2,13,14,18,21,27,28],electr:[2,22],electrostat:[2,24,34],elegantli:[2,13],element:[2,14,16,28,43,48],emplac:[2,44],emploi:[2,28],empti:[2,48],end:[2,4,6,8,14,25,27,28,41],endmdl:[2,14],endmdlpars:[2,13],endpars:[2,13],energi:[2,19,20,21,22,23,24,26,27,28,29,33,38,39,40,41,42,57],enough:[2,28],ensembl:11,ensur:[2,28],entir:[0,18,29],entiti:[2,16],enumer:[2,8,28,47,50,51,53,55],environ:[2,44],ep:[2,19,20,21,23,28,38,40,41,42,57],eps_kb:[2,36,57],eps_r:[2,22],epsilon:[2,40],epsilon_0:[2,22,57],equal:[2,6,48],equilibrium:[2,29,38],equival:[2,55],error:[2,16,44],esbas:[2,22,25],especi:[2,10,18,48],essenti:[2,13,27],estim:[2,28,44],etc:[2,6,11,13,15,18,28,35,47,50,51,55],eval:[2,27],evalu:[2,24,31],even:[2,22],everi:[2,7,28,39,48],everyth:[2,7],everywher:[2,43],exact:[2,8],exactlegacysaw:[2,6],exampl:[2,4,12,25,30,39,43,44,48,50],exce:[2,47],excess:[2,23],exclpair:[2,26],exclud:[2,27],exclus:[2,21,24,25,34,41,42],execut:[2,24,25,28,30,31,32,33],exist:[2,21,28],expens:[2,27],explicit:[2,10,12,15,18,29,30,33,36,37,43,50,51,55,57],explicitli:[2,15],exportpdb:[2,30,31,45],exportto:[2,46],express:[2,38,40,41,42],extent:[2,4],extra:[2,10,48],extract:[2,12,16],extrapol:[2,10],f1:[2,38,40,41,42],f2:[2,38,40,41,42],f77mass:[2,36,57],f77unit:[2,57],f:[2,8,44],facil:[2,47,50,51,55],factor:[2,28],factori:[2,17,34,44],failur:[2,8,14],fals:[2,6,27,28,36,43,44,48,50,56],famili:43,far:[2,27,57],fashion:[2,48],faster:[2,27,48],featur:[2,38],fetch:[2,25,27,28,29,30,32],field:[2,11,13,19,20,21,24,38,39,40,41,42,44,53],fifth:[2,36],file:[0,2,3,5,8,9,10,12,16,18,19,21,30,32,46,57],filesystem:[2,15,30],filter:[2,22,28,48],find:[2,3,10,19,21,46],fine:[2,40],finish:[2,45],first:[2,5,18,22,23,28,30,38,40,41,42,47,48],fix:[2,56],flatten:[2,48],flush:[2,33],follow:[2,8,9,11,18],forc:[0,2,19,20,21,23,25,27,28,31,34,35,38,39,40,41,42,44,45,48,53],forcefield:[2,18,25],form:[2,4,7,10,13,18,28,32,39,43,47],format:[2,4,5,7,8,9,12,14,28,47],formationmaxdistsq:[2,28],formationtim:[2,28],formationtoler:[2,28],formula:[2,19,21,38,39],fortran:[2,6,8,32,36,47,54,57],found:[2,10],framework:[5,9],free:[2,28],freepair:[2,28],friend:[2,12,19,21,50,51,55],from:[2,4,6,7,8,9,10,11,12,13,15,16,17,18,21,23,24,25,26,27,28,29,32,38,41,44,46,47,48,50,51,54,55],fromn:[2,29],full:[2,7,9,10,28],gamma:[2,36],gaussian:[2,27],gaussiannois:[2,36],gener:[0,2,6,9,12,16,18,22,23,25,26,27,28,47,48,50,52],generatenois:[2,36],geometri:[2,28],geometryphas:[2,28],get:[2,12,16,24,28,43],getnewrandom:[2,54],gg:[2,53],github:0,given:[2,6,7,10,11,18,32,43,47,48],gln:[2,50,55],global:[2,23],glu:[2,50,55],gly:[2,50,55],gly_pro:2,go:[2,4,24,34,48],got:[2,28],gp:[2,53],grain:0,greater:[2,30],grid:[2,48],group:[2,55],gx:[2,53],h1:[2,38],h2:[2,38],h:[2,18,28],h_i:[2,28],h_j:[2,28],ha:[2,10,11,19,21,25,28,44],hamiltonian:[2,27],handl:[2,8,41],harm:[2,29],harmon:[2,18,29,34,39],hash:[2,50,51,55],have:[2,5,8,10,18,19,24,28,35,38,47,48,57],header:[2,8],heavi:[2,50],heavyatom:[2,50],henri:[2,57],here:[2,5,8,10,15,18,19,21,22,26,27,28,38,40,41,42,43,47],hetatmpars:[2,13],heterogen:[2,16,44],heurba:[2,19],heurdih:[2,21],heurest:[2,7,19,21],heuresticba:[2,19,45],heuresticbondangl:[2,53],heuresticdihedr:[2,21,45],heuresticdihedralangl:[2,53],hh_abs_min:[2,28],hi:[2,50,55],hide:[2,43],high:[2,40],high_resolution_clock:[2,33],hold:[2,16,25],home:[0,46],hook:[0,2,25,34,44,48],how:[2,8,33],howev:[2,39,48,57],hpp:[2,8,13,19,20,21,22,23,27,28,43,47,50,51,54,55,56],hr_abs_min:[2,28],hueckel:[2,22],hydrophob:[2,7,47],hydrophobicss:[2,47],hyperplan:2,i1:[2,18,22,23,28,47],i2:[2,18,22,23,28,47],i:[2,4,6,7,8,9,10,12,15,16,18,19,20,21,22,25,27,28,29,30,31,32,38,40,41,43,44,45,46,48],i_1:[2,27],i_2:[2,27],idx:[2,6,10],idxinchain:[2,10],idxinr:[2,10],il:[2,50,55],ill:[2,10],immut:17,implement:[2,11,25,27,32,41],improp:[2,24,34],inbackbon:[2,50],includ:[2,8,13,19,20,21,22,23,27,28,43,47,50,51,54,55,56],include_subdirectori:3,inclus:[2,8],incongru:[2,57],increas:[2,28,48],incur:39,inde:[2,28],independ:5,index:[2,6,8,10,18,19,21,22,28,30,43,44,48,50,51,55],indexof:[2,48],indic:[2,4,6,18,22,48],industri:[2,40],ineffici:[2,43],infinit:[2,6],influenc:[2,4],info:[2,50],inform:[2,6],init:[2,35,36,37,43,44],initi:[2,6,15,22,30,35,36,37,43,44,47,48],initveloc:[2,6],inlin:[2,8,16,18,19,21,28,30,32,36,37,38,39,40,41,42,43,44,47,50,51,54,55,56,57],input:[2,4,7,9,12,32],inputpath:[2,32],inrang:[2,19,20,21],insert:[2,47],insertioncod:[2,14],insofar:[2,44],instal:0,installintovl:[2,25],instanti:[2,6,45,50,51,55],instead:[2,27,48],institut:0,int8_t:[2,8,21,22,43,47,50,51,55],integ:[2,8,11,13,18,43],integr:[0,2,24,34,44,45],inter:[2,43],interact:[2,22,23,27,29],interfac:[2,24,31,34,43],interfer:[2,23],intern:[2,6,8,12,30,33,44,48],interpos:[2,15],intersect:[2,6],intuit:[2,6],invalid:[2,6,10,44],invers:[2,20],invok:[2,15,25,30,32,33,44,48],isconnect:[2,29],isn:[2,10,19,21],isprop:[2,50],istermin:[2,18],istream:[2,4,7,12],item:[2,28],iter:[2,43],its:[2,4,21,25,28,57],itself:[2,19,21,43],j:[2,8,27,28,40,41,42,48],jakub:0,jan:0,jone:[2,7,23,26,27,28,34,39],joul:[2,57],juliusz:0,just:[2,8,28,48],k:[2,4,18],k_:[2,19],kb:[2,57],kcal:[2,57],keep:[2,22,26],kei:[50,51,55],kelvin:[2,57],kernel:[0,2,29,34],kg:[2,57],know:[2,22],kopaczyk:0,l:[2,27,28,40,41,42],lack:[2,18],lambda:[2,27,44],lambdapeak:[2,27],lang:[2,36],lang_mass:[2,36],langevin:[2,34,35],langpredictorcorrector:[2,35,36],larg:[2,48],last:[2,18,30,48],latter:[2,24],layer:0,lead:[2,44],leapfrog:[2,34,35],least:[2,6,18],left:[2,8],legaci:[2,4,7,38,48,54],legacymorphintosaw:[2,6],legacypars:[2,4,7,15],len:[2,4,6],length:[2,4,6,10,20,38],lennard:[2,7,23,26,27,28,34,39],lennardjon:[2,27,28,40],less:[2,6,27,57],let:[2,48],leu:[2,50,55],librari:[0,2,3,5,44],lifetim:[2,18],like:[2,8,12,15,16,25,36],line:[2,6,8,11,13],linear:[2,28],linestream:2,link:[2,10,12,14,48],linker:[2,16,44],linklength:[2,14],linkpars:[2,13],list:[0,2,4,6,10,11,12,13,19,20,22,23,25,26,27,28,29,32,34,43,44,45,47],lit:[2,8],liter:[2,8],load:[2,5,8,28,32],loc:[2,48],local:[2,22,25,26,27,39,48],locat:[2,4,8],look:[2,3,36],lose:[2,28],lot:[2,12,39],lowest:[2,30],lsimpang:[2,7],ltrim:2,lvalu:[2,38,40,41,42],ly:[2,50,55],m:[2,8,36,37,40,43],m_pi:[2,57],mai:[2,10,25,44,48,55],main:[2,44],make:[2,6,8,57],mani:[2,8,9,28],manipul:[2,47],map:[0,2,5,7,10,15,32,50,51,55],mark:[2,28],mass:[2,6,16,18,36,37,50,55,57],massiv:39,matrix3xd:[2,43],matrix:[2,7,21,22,43],maxhydrophobicss:[2,7],maxim:[2,48],maximum:[2,7,28],maxpolarss:[2,7],maxsidechain:[2,7],mdk:[2,3,4,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,35,36,37,38,40,41,42,43,44,45,46,47,48,50,51,53,54,55,56,57],mean:[2,4,6,8,11],medium:[2,6,22],member:[2,4,6,7,8,10,12,13,14,15,16,18,19,20,21,22,23,26,27,28,29,30,32,33,36,37,38,40,41,42,44,46,47,48,50,51,54,55,56],memori:[2,23,28],mess:[2,6],met:[2,50,55],meter:[2,57],method:[2,10],microsecond:[2,30,57],millisecond:[2,57],minbondsep:[2,48],mind:[2,6],mindist:[2,6],minim:[2,23,48],minimum:[2,6,28,30,48],miss:2,mj:[2,7],mjmatrix:[2,7],mode:[2,8],model:[0,2,4,5,8,9,12,14,15,16,17,18,20,24,27,30,34,43,44,46,57],modelidx:[2,30],modelpars:[2,13],modelpath:[2,30],modern:[2,54],modif:[2,6,25],modifi:[2,5,8,9,24,25,28,44],mol:[2,57],molecul:[2,55],moment:[2,3,6,8,10,30,55],monost:[2,13,14,21],more:[2,5,6,9,20,27,28,43,57],moreso:[2,22],morph:[2,6],morphintolin:[2,6],morphintosaw:[2,6,15],most:[2,8,16,22,44,48],mostli:[2,28],mu:[2,54],mu_0:[2,57],much:[2,38,48],multi:[2,24],multipli:[2,8,28],must:[2,4,11,18,25,33,39,44],mutabl:[2,25],mutex:[2,28],mutual:[2,21],my:[2,44],n:[2,6,8,18,27,28,29,43,46,48,50,54],n_i:[2,28],name:[2,50,51,55],namespac:[0,8,13,14,19,20,21,22,23,27,28,43,47,50,51,53,54,55,56,57],nanomet:[2,57],nanosecond:[2,57],nat:[2,10,15,51],nat_b:[2,10,51],nat_bb:[2,10,51],nat_r:[2,6],nat_sb:[2,10,51],nat_ss:[2,10,51],natba:[2,19],natdih:[2,21],nativ:[2,4,6,7,10,18,19,20,21,24,25,29,34],nativeba:[2,19,45],nativebondlen:[2,6],nativecontact:[2,23,25],nativedihedralbas:[2,21,45],nativequad:[2,18],nativetripl:[2,18],nativetupl:[2,18],natur:[2,39,47],necessari:[2,15],necessarili:[2,10,18],need:[2,8,15,25,43,48],needtoreset:[2,48],neighbor:[2,18,48],ness:[2,24],never:[2,44],nevertheless:[2,28],newli:[2,48],newvl:[2,23],next:[2,48],nois:[2,34,35],non:[2,7,10,28,39,44,48],nonetheless:[2,36],nonloc:[2,23,24,34,44,48],nonlocalforc:[2,22,23,24,25,26,27,28,44,48],nonlocalpair:[2,6],nonneg:[2,48],norm:[2,40,41,42],normal:[2,8,33,38,40,41,42,54],notabl:[2,29],note:[2,4,6,8,10,19,21,22,25,28,33],noth:[2,21],now:[2,28,36,43],nr_max:[2,28],nullptr:[2,6,10,18,19,21,24,25,27,28,30,32,33,35,36,44,47,48],number:[0,2,6,7,8,10,11,14,29,30,31,32,33,43,44,47,48,50,51,52,53,55],numeric_limit:[2,30],numofpt:[2,19,21,53],o:[2,48],object:[0,2,5,6,8,10,12,19,20,21,22,23,24,25,26,27,28,29,30,32,33,34,35,36,37,45,47,48,50,51,55,56],obtain:[2,10,18],occup:[2,14],occur:[2,28],off:[2,4,6,40],offer:[2,43],offset:[2,4,8,18],ofstream:[2,32],often:[2,33],old:[2,28],oldidx:[2,28],oldpair:[2,28],onc:[2,44],one:[2,3,6,7,9,11,15,16,17,18,19,21,25,28,30,41,43,47,48,55],ones:[2,28],onli:[2,6,8,10,12,19,21,22,24,25,28,30,38,44,48],onlyatom:[2,12],oper:[2,8,12,28,43,47,50,51,55,56],oppos:[2,8,10,47],optim:[2,28,48],option:[2,6,7,15,44],order:[2,8,10,11,15,19,21,24,25,27,28,36,38,40,41,42,48],ordin:[2,8],os:[2,4,7,12,13],ostream:[2,4,7,12,13],oth:[2,54],othdyn:[2,46],other:[2,6,9,12,13,22,28,29,41,44,47,50,51,55],otherwis:[2,16,18,19,21,27,28,29,39,50],out:[2,8,13,39],output:[2,4,5,7,12,13,30,32,33,46],outputpath:[2,32],outright:[2,28],outsid:[2,48],over:[2,6,43],overflow:[2,8],overhead:57,overlai:[2,6],overlap:[2,10,26],overrid:[2,8,19,20,21,22,23,24,25,26,27,28,29,30,32,33,35,36,37,46,47,48],oversatur:[2,28],own:[2,4,48],p:[2,4,16,28],pad:[2,48],pair:[0,2,6,7,18,19,21,22,23,25,26,27,28,29,41,43,48,52,54],pairinfo:[2,27,28],pairtyp:[2,7,53],pairwisemindist:[2,7],param:[2,6,7,10,16,17,18,44,47],paramet:[0,2,4,5,6,8,10,12,13,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,35,36,37,38,40,41,42,43,44,45,46,47,48,50],parent:[2,6,10],pars:[0,2,4,5,7,8,12,13,14,15],parser:[2,4,7,9,11,12,15],part:[2,4,6,10,18,19,20,21,22,23,24,26,27,28,29,38],particular:[2,6,8,11,12,19,20,21,24,25,28,30,45,47,48,56],pass:[2,9,28,38,40,41,42,43],path:[2,15,30,32],pauli:[2,24,34,41,42],pauliexclus:[2,25,26],pbc:[2,10,56],pdb:[0,2,5,31,34],pdf:[2,18,28,41],per:[2,15,21],peraciddata:[2,7],percel:[2,48],percentag:[2,33],perform:[2,22,23,25,26,27,28,31,39,44],perhap:[2,25,38],period:[2,30],permitt:[2,22],perpair:[2,48],perpairdata:[2,7],perptdata:[2,7],perresiduedata:[2,14],pertain:[2,18,27,50],pg:[2,53],pham:0,phe:[2,50,55],phi0:[2,21],phi:[2,21],physic:[0,2,28,34,44,52],place:[2,3,6,16,17,29,39,47,48],plane:[2,21],po:[2,14],pod:[2,4,7,14],point:[2,30,44,54],pointer:[2,8,10,13,24,25,27,30,32,44],polar:[2,7,47],polar_neg:2,polar_po:2,polarss:[2,47],polish:0,polynomi:[2,19],pool:[2,28],popul:11,posit:[2,4,6,8,10,12,15,20,30,31,34,35,46,48],positiondiff:[2,31,32,45],possibl:[2,19,21,28,48],potenti:[2,7,9,10,11,18,22,24,26,29,33,34,39],pow:[2,6,19,21,38],pp:[2,53],practic:[2,41,48],precis:[2,8,11],predictor:[2,34,35],prepar:[0,2,6],preparedyn:[2,46],present:[2,22,28],preserv:[2,28],pretti:[2,38],prevent:[2,28],prevtim:[2,33],primarili:[2,10],primit:[0,34],print:[2,8,9,33],privat:[2,6,8,12,16,19,20,21,23,26,27,28,29,30,32,33,36,37,44,47,48,50,51,54,55],pro:[2,50,55],procedur:[2,6,47],process:[2,6,28],product:[2,22],program:[2,8,23,57],progress:[2,31,34],progressbar:[2,31,33,45],progrss:[2,33],project:[0,3,46],prone:57,proper:[2,50],protect:[2,13,21,22,24,25,26,27,35],protein:0,prototyp:[2,21,24],provid:[2,3,4,5,8,9,11,12,13,16,17,20,25,44,47],ps:[2,44],pseudo:[2,24,34,55],pseudoatom:[2,6],pseudoimproperdihedr:[2,25,27],psi0:[2,27],psi:[2,27],psi_1:[2,27],psi_2:[2,27],ptr:[2,18],px:[2,53],q1_x_q2:[2,22],qa:[2,18,24,28,30],qacontact:[2,28],qadiff:[2,28],qadiffsmutex:[2,28],qafreepair:[2,28],quad:[2,18],quadrupl:[2,4,7,18,20,21],quasi:[2,23,24,27,34],quasiadiabat:[2,25,28],r0:[2,22,48],r:[2,4,6,10,22,41,46],r_0:[2,22],r_:[2,20,27],r_cut:[2,42],r_i:[2,20],r_j:[2,28],r_min:[2,23,40],rad:[2,19,21,57],radii:[2,7,10],radiu:[2,7,50],rand:[2,6],random:[0,2,6,36,52],rather:[2,8,19,24,25,44],raw:[2,5,9],re:[2,4,6,10,14],reach:[2,28],read:[2,4,7,8,12,13,15],readm:[2,4,7,15],real:[2,8,11,33],realiz:[2,16],realtime0:[2,33],reconstruct:[2,26,48],record:[2,5,9,12,30],recordpars:[2,11,12,13],recov:9,recreat:[2,22],reduc:[2,9,10,48],reduct:[2,10],refer:[2,3,10,14,15,16,19,21,28,30,32,43,44],referenc:[2,44],refposit:[2,32],regard:[2,28],regener:[2,28],regist:[2,25,48],registernf:[2,48],rel:[2,4,15,46],relativedh:[2,22],relev:[2,16,25,48],remain:[2,47],remark:[2,14,30],remarkpars:[2,13],remov:[2,23,25,28],replac:[2,20],replic:[2,6,36],report:[2,14],repres:[2,4,6,7,8,9,10,13,27,44,47,50,51,55,56],requir:[2,25,28],requisit:5,resid:[2,10],residu:[0,2,4,6,7,10,18,20,22,23,26,27,28,29,30,38,40,41,42,43,46,47,48,52,56],residuenam:[2,14],residueseqnum:[2,14],resiz:[2,43],resolut:[2,30],respect:[2,28],respons:[2,38,44],restrict:[2,48],restyp:[2,6,43,51,55],restypeidx:[2,55],result:[2,5,15,18,28],retriev:[2,12,16,21,23],reus:[2,18],right:[2,8],rng:[2,36],root:3,rough:[2,48],rtrim:2,run:[2,23,25,44],runtim:57,s:[2,8,10,13,18,19,20,21,25,28,29,38,39,41,43,44,47,54,57],safe:[2,16,24],sai:[2,11,44],same:[2,8,12,18,39],sampl:[2,54],save:[2,8,24,29,30,32,48],saveddata:[2,16],savedspec:[2,25],saw:[2,6],sb:[2,28,47],scalar:[2,8,18,19,20,21,28,29,43],scale:57,scienc:0,screeen:[2,22],screen:[2,15,22],screeningdist:[2,15,22],second:[2,18,22,23,28,38,40,41,42,47,57],see:[2,6,8,9,11,14,27],seed:[2,54],seem:[2,40],seemingli:[2,44],seen:[2,38],select:[2,28],self:[2,6],sens:[2,28],separ:[2,6,18,24,28,29,38,39,48,55],sepbyatleastn:[2,18],seq:[2,15,27],sequenc:[0,2,5,10,21],sequenti:[2,28],ser:[2,50,55],serial:[2,10,30],serialnum:[2,14],serv:[2,6,13,21,24],set:[2,6,7,12,15,29,30,36,46,50],setcel:[2,56],sg:[2,50],shape:[2,6,10,12,46,48],share:[2,44],shared_ptr:[2,12,13,16,44],shift:[2,26,34,39],shiftedtruncatedlj:[2,26,42],should:[2,11,23,27,28,29,57],shouldn:[2,4,21,22,24,25,28],side:[2,41],sidechain:[2,7,10,15,27,28,34,39,47],sidechainlj:[2,27,28,41],sigma:[2,40,54],signal:[2,8],signific:[2,48],similar:[2,18],simpl:[2,21],simplenativedihedr:[2,21],simpli:[2,26,47],simplifi:[2,7,47],simul:[0,2,5,6,9,12,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,35,36,37,46,47,48,56],simulvar:[2,19,21,24,30,32,33,35,45,46,47,48],sinc:[2,4,15,22,28,30,39,57],singl:[2,6,8,9,10,11,12,13,15,18,20,21,39,41,50],sink_max:[2,41],site:[2,55],size:[2,6,14,18,43,48],size_t:[50,51,55],skiplin:2,slice:[2,43],slot:[2,28,47],small:[2,43],so:[2,7,22,23,30,39,44,47,48,55],solid:2,solidwal:[2,24],some:[2,10,14,18,25,27,29],somewhat:[2,23],sort:[2,28,43],sourc:[2,6],spacegroup:[2,14],span:[2,30,33],spec:[2,22,23,25,26,27,28,48],special:[2,23],specialz:[2,16],specif:[2,4,7,22,27,48],specifi:[2,8,10,15],specificityparam:[2,7],sphere:[2,54],split:[2,7],spuriou:[2,48],squar:[2,48],ss:[2,27,28,47],ss_lj:[2,27,28],ssbond:[2,10,12,14,29,51],ssbondpars:[2,13],stage:[2,24],standard:[2,8,25,29,40,43],start:[2,4,6,10,28,33],stat:[0,2,28,30,34,45],statdiff:[2,28],state:[0,2,24,30,32,33,34,35,36,37,44,45,48,54],statu:[2,28,33],std:[2,4,6,7,8,10,12,13,14,15,16,21,22,23,28,30,32,33,36,43,44,47,48,50,51,53,54,55],step:[2,30,31,32,33,44,48],step_nr:[2,30,31,32,33,44],stl:[50,51,55],stlj:[2,26],storag:5,store:[2,10,15,16,21,22,30,43,44],stream:[2,4,7,9,12,13,32],string:[2,8,10,13,14,15,32,50,51,55],string_view:2,stringstream:2,struct:[2,4,6,7,10,14,15,22,23,28,47,48,50,51,55],structur:[2,4,6,7,10,11,13,18,20,28,29,50],structuredpart:[2,6],sub:[2,48],subclass:[2,8,13,21,22,24,25,31,35,45],subtract:[2,8],succe:11,succeed:[2,28],success:[2,11,28],suit:[2,44],superced:[2,19,21],supp:[2,27,46],support:[2,27],suppos:[2,20],sure:[2,40],swap:[2,13,23,28],symmetri:[2,8],symmetryop:[2,14],symop:[2,8],synchron:[2,24,28],syncpart:[2,24,28],t0:[2,28,48],t1:[2,38,40,41,42],t2:[2,38,40,41,42],t:[2,3,4,6,7,10,21,22,24,25,28,43,44,46],take:[2,3,9,10,32,35,48],taken:[2,6,28,33,39,44,47,54],target:[2,3,6],task:[2,44],tau:[2,28,36,37,57],team:0,technic:[2,10,15,21,48],temperatur:[2,6,36],tempfactor:[2,14],templat:[2,7,16,38,40,41,42,44,50,51,55],ter:[2,14],term:[2,19,21,27],terpars:[2,13],test:[2,6,27],tether:[2,18,24,34],text:[2,13,14,50],th:[2,18,43],than:[2,9,27,30],thei:[2,6,28,39,57],them:[2,5,10,17,28,38,44,48],theoret:[2,27],therefor:[2,6],thereof:[2,27],thermal:[2,28],theta0:[2,19],theta:[2,19],thi:[0,2,4,10,16,18,21,22,24,25,28,29,30,31,32,36,41,43,44,47,48,55,57],those:[2,23],though:[2,43],thought:[2,55],thr:[2,50,55],thread:[2,28],three:[2,27],through:[2,28,44,48],thu:[2,15,18,24,28,44,48],time:[2,28,30,33,44,46,48,57],time_point:[2,33],timespan:[2,28],too:[2,33,40],top0:[2,48],top:[2,6,10,46],topolog:[0,2,6,10,46,48,52],total:[2,33,44],totaltim:[2,33],tprev:[2,30],tri:[2,11,44],trim:[2,8],tripl:[2,4,7,18,19],trivial:[2,44],trp:[2,50,55],truncat:[2,26,34,39],trypars:[2,13],tupl:[2,18],two:[2,6,7,10,21,28,36,38,40,41,42,54,55],two_norm:[2,54],txt:[2,3,4,7,15],type:[0,2,6,7,8,9,10,14,16,19,21,27,28,33,38,40,41,42,43,44,47,50,52],type_index:[2,16,44],typedef:[2,14,43],typenam:[2,7,16,38,40,41,42,44],tyr:[2,50,55],uint64_t:[2,54],undefin:[2,4,19,21],underli:[2,8,13,16,18,29,50,51,55],unflatten:[2,48],unif:[2,10],uniform:[2,54],unit:[0,2,8,22,38,40,41,42,52],uniti:[2,43],univers:0,unless:[2,28],unordered_map:[2,7,10,12,15,16,44,50],unordered_set:[2,50],unsuccess:[2,13],until:11,unus:[2,28],updat:[2,22,23,25,27,28,33,44,48],updategrid:[2,48],updateperiod:[2,33],updatewithdyn:[2,46],upon:[2,44],urbanek:0,us:[2,3,4,5,6,7,8,10,12,14,16,18,22,25,26,27,28,29,33,38,39,40,41,42,43,44,48,50,51,54,55,56,57],useaveragemass:[2,6],usemass:[2,6],usetop:[2,6],usual:[2,8,25,28,43,44,45],util:[0,2,5,6,12],v1:2,v2:2,v3:2,v4:2,v:[2,6,8,19,21,38,40,41,42,46,56],v_i:[2,20],val:[2,50,55],valid:[2,47],valu:[2,4,8,10,13,16,19,20,21,27,28,29,30,36,40,43,44,46,47,48,50,51,53,55],variabl:[0,2,13,27,28,34,38,40,41,42,44,53,57],variant:[2,9,14,19,21],variou:[2,43,57],vector3d:[2,10,14,43,54],vector3i:[2,48],vector:[2,4,6,7,10,12,13,15,22,23,27,28,32,36,37,38,40,41,42,43,44,46,47,48,50,53,56],vectorbas:[2,43],vectorwis:[2,43],vectorxd:[2,43],veloc:[2,6,35,36,46],verbatim:[2,26],verlet:[0,2,22,23,25,26,27,28,34,44],verlet_list:[2,44],versa:[2,8],version:[2,6,26,27,41,42,47,48,54,57],via:[2,8,9],vice:[2,8],view:2,virtual:[2,8,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,35,36,37,45,46,47,48],vl:[2,22,23,25,26,27,28,43,44,45,48],vlupdatehook:[2,22,23,25,26,27,28],vref:[2,38,40,41,42,43,56],w:[2,4],wa:[2,13,30,32,33,48],wai:[2,6,28,47],walk:[2,6],wall:2,want:[2,9,22,23,28,55,56],warn:[2,43],warsaw:0,wast:[2,48],water:[2,55],we:[2,8,9,10,12,13,15,17,18,22,23,24,26,27,28,29,36,43,44,47,48,54,55,56,57],well:[2,41],were:[2,28,30,43,47,57],what:[2,6,38,40],when:[2,8,10,12,19,21,22,23,25,26,27,28,30,31,33,44,48],whenev:[2,19,21],where:[2,12,18,20,21,24,27,47,48],whereaft:[2,32],wherefrom:[2,4,7,12],whereof:[2,18],whereto:[2,4,7,12],wherewith:9,whether:[2,6,10,19,21,27,29,44,47,48,50],which:[2,3,6,8,9,10,11,13,15,19,21,22,23,28,29,30,32,40,45,48],whose:[2,48],width:[2,8,11,27,33],wiser:[2,55],wish:[2,18,28],within:[2,23,27,30],without:[2,5,15],work:[2,8],would:[2,22,28,48],wouldn:[2,7,43],write:[2,4,7,8,11,12,13,43],written:[2,8,9],wrt:[2,19,21,27],x:[2,50,51,55],xg:[2,53],xml:46,xp:[2,53],xx:[2,53],y0:[2,36],y1:[2,36],y2:[2,36],y3:[2,36],y4:[2,36],y5:[2,36],yet:[2,44],z:[2,14],zero:[2,10,15,38,47],zpp_backup:46},titles:["Molecular Dynamics Kit","Architecture of the library","Entire namespace","Installation","Contact map files","Preparation layer","Model","Parameter files","PDB record fields","PDB objects and parsing","PDB atomic model","PDB parsing framework","Raw PDB data","PDB record parsers","PDB file records","Sequence files","Data objects factory","Data objects","Data objects","Bond angle potential","Chirality potential","Dihedral angle potentials","Electrostatic forces","Go-model native contacts potential","Forces","Nonlocal function interface","Pauli exclusion forces","Pseudo-improper-dihedral custom potential","Quasi-adiabatic custom potential","Chain tether forces","PDB export hook","Hooks","Position diff hook","Progress bar hook","Simulation layer","Integrators","Predictor-corrector integrator with Langevin noise","Leapfrog integrator","Harmonic potential kernel","Kernels","Lennard-Jones potential kernel","Sidechain Lennard-Jones potential kernel","Shifted and truncated Lennard-Jones potential kernel","Primitives","Simulation object","Simulation variables","Physical state object","Coordination stats","Verlet list","Tutorial","Amino acid class","Contact type class","Utilities","Pair type class","Random number generation","Residue type class","Topology class","Physical unit definitions"],titleterms:{"class":[50,51,53,55,56],"export":30,"function":25,"new":11,acid:50,ad:11,adiabat:28,amino:50,angl:[19,21],architectur:1,atom:10,bar:33,bond:19,chain:29,chiral:20,contact:[4,23,51],coordin:47,corrector:36,custom:[27,28],data:[12,16,17,18],definit:57,diff:32,dihedr:[21,27],dynam:0,electrostat:22,entir:2,exclus:26,factori:16,field:8,file:[4,7,14,15],forc:[22,24,26,29],framework:11,gener:54,go:23,harmon:38,hook:[30,31,32,33],improp:27,instal:3,instanc:[31,35],integr:[35,36,37],interfac:25,jone:[40,41,42],kernel:[38,39,40,41,42],kit:0,langevin:36,layer:[5,34],leapfrog:37,lennard:[40,41,42],librari:1,list:48,map:4,model:[6,10,23],modul:[5,11,17,34],molecular:0,namespac:2,nativ:23,nois:36,nonloc:25,number:54,object:[9,16,17,18,44,46],pair:53,paramet:7,pars:[9,11],parser:13,pauli:26,pdb:[8,9,10,11,12,13,14,30],physic:[46,57],posit:32,potenti:[19,20,21,23,27,28,38,40,41,42],predictor:36,prepar:5,primit:43,progress:33,pseudo:27,quasi:28,random:54,raw:12,record:[8,11,13,14],residu:55,section:0,sequenc:15,shift:42,sidechain:41,simul:[34,44,45],special:24,stat:47,state:46,tether:29,topolog:56,truncat:42,tutori:49,type:[11,51,53,55],unit:57,util:52,variabl:45,verlet:48}})
\ No newline at end of file
@@ -3,6 +3,22 @@
 #include "Vectors.hpp"
 
 namespace mdk {
+    /**
+     * Floating-point type in which the kernels (see the \p kernels
+     * directory: the pairwise potentials and the tethers) are evaluated:
+     * single precision if the library is built with MIXED_PRECISION, double
+     * precision otherwise. The forces computed from \p ChainGeometry (bond
+     * and dihedral angles, chirality, the directional terms of the
+     * quasi-adiabatic potential) are not ported and remain in double
+     * precision, as do the accumulation of the forces and of the energy, and
+     * the integrators.
+     */
+#ifdef MIXED_PRECISION
+    using Real = float;
+#else
+    using Real = double;
+#endif
+
     /// A list of scalars (i.e. doubles).
     using Scalars = Eigen::VectorXd;
 
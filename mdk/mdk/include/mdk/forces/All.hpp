@@ -1,12 +1,17 @@
 #pragma once
 
+#include "BondedForce.hpp"
 #include "Chirality.hpp"
+#include "FusedBonded.hpp"
+#include "FusedNonlocal.hpp"
 #include "NonlocalForce.hpp"
 #include "PauliExclusion.hpp"
 #include "PseudoImproperDihedral.hpp"
 #include "Tether.hpp"
+#include "angle/BondAngles.hpp"
 #include "angle/HeuresticBA.hpp"
 #include "angle/NativeBA.hpp"
+#include "dihedral/DihedralAngles.hpp"
 #include "dihedral/SimpleNativeDihedral.hpp"
 #include "dihedral/ComplexNativeDihedral.hpp"
 #include "dihedral/HeuresticDihedral.hpp"
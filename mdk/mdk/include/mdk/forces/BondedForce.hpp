@@ -0,0 +1,42 @@
+#pragma once
+#include "Force.hpp"
+
+namespace mdk {
+    template<typename... Terms>
+    class FusedBonded;
+
+    /**
+     * A bonded (local) force interface, i.e. of the forces which are sums of
+     * the terms for the pairs, triples etc. of consecutive residues in the
+     * chains (tethers, bond angles, dihedrals etc.). The terms are indexed
+     * by a residue, so that the bonded forces may be evaluated together in
+     * a single pass over the chains (see \p FusedBonded).
+     */
+    class BondedForce: public Force {
+        template<typename... Terms>
+        friend class FusedBonded;
+
+    public:
+        /**
+         * Computes the terms of the force associated with a block of
+         * consecutive residues; the residues involved in the term of a
+         * residue i are at most two positions before and one position after
+         * it, i.e. within (i-2, ..., i+1). Any choice of the variant of the
+         * force etc. is made once per block rather than for every residue.
+         * @param begin Index of the first residue of the block.
+         * @param end Index past the last residue of the block.
+         * @param dynamics Dynamics object to add potential energy and forces
+         * to.
+         */
+        virtual void blockPart(int begin, int end, Dynamics& dynamics)
+            const = 0;
+
+    protected:
+        /**
+         * Whether the force is evaluated in a fused pass (see
+         * \p FusedBonded) rather than in its own \p asyncPart; \p asyncPart
+         * then does nothing.
+         */
+        bool fused = false;
+    };
+}
@@ -1,5 +1,6 @@
 #pragma once
-#include "Force.hpp"
+#include "BondedForce.hpp"
+#include "../system/ChainGeometry.hpp"
 
 namespace mdk {
     /**
@@ -8,7 +9,7 @@ namespace mdk {
      * replacement for bond and dihedral potentials, if the native structure
      * is provided.
      */
-    class Chirality: public Force {
+    class Chirality: public BondedForce {
     private:
         /**
          * A list of cube inverses of $d_0$, where $d_0$ is the length of
@@ -27,6 +28,18 @@ namespace mdk {
          */
         Bytes inRange;
 
+        /// Bond vectors and their cross products.
+        ChainGeometry const* geometry = nullptr;
+
+        /**
+         * Computes the term of the force associated with a given residue, i.e.
+         * for the quadruple (i-2, i-1, i, i+1).
+         * @param i Index of the residue.
+         * @param dynamics Dynamics object to add potential energy and forces
+         * to.
+         */
+        void residuePart(int i, Dynamics& dynamics) const;
+
     public:
         /**
          * The amplitude of the potential.
@@ -45,5 +58,15 @@ namespace mdk {
          * to.
          */
         void asyncPart(Dynamics &dynamics) override;
+
+        /**
+         * Computes the terms of the force associated with a block of
+         * residues (see \p BondedForce::blockPart).
+         * @param begin Index of the first residue of the block.
+         * @param end Index past the last residue of the block.
+         * @param dynamics Dynamics object to add potential energy and forces
+         * to.
+         */
+        void blockPart(int begin, int end, Dynamics& dynamics) const override;
     };
 }
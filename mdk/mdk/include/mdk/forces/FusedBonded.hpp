@@ -0,0 +1,95 @@
+#pragma once
+#include "BondedForce.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+
+namespace mdk {
+    /**
+     * A fused pass over the chains for a number of bonded forces. Normally
+     * each bonded force goes through all the residues on its own, reading
+     * the positions (or the bond vectors) of the same residues and adding
+     * the forces to the same ones; here, the residues are divided into
+     * blocks of \p blockSize consecutive residues, and the forces are
+     * evaluated for one block after another, so that the data of the
+     * residues of a block (the bond vectors, the parameters of the terms
+     * and the forces) are reused while they are in the cache.
+     *
+     * The terms of a block involve also up to two residues before and one
+     * after it (the "halo"), which are shared with the neighbouring blocks;
+     * the data of the halo are only read, and the forces are added to the
+     * \p Dynamics object of the thread, so the blocks need no separation.
+     *
+     * The types of the forces are template parameters, so that they are
+     * invoked directly (once per block) rather than with the virtual
+     * dispatch, and so that any choice of the variant of a force is made
+     * once per block too. The pass is added to the simulation after the
+     * fused forces; the contributions of the terms are then summed in a
+     * different order, so the results may differ up to rounding.
+     * @tparam Terms Types of the forces to fuse (for example \p Tether,
+     * \p BondAngles or \p DihedralAngles).
+     */
+    template<typename... Terms>
+    class FusedBonded: public Force {
+        static_assert((std::is_base_of_v<BondedForce, Terms> && ...),
+            "FusedBonded can only fuse bonded forces");
+
+    public:
+        /**
+         * Construct the pass.
+         * @param terms Forces to fuse, already added to the simulation
+         * (the composite ones, such as \p DihedralAngles, may be accessed
+         * with \p Simulation::var).
+         */
+        explicit FusedBonded(Terms&... terms):
+            terms { &terms... } {};
+
+        /**
+         * Number of residues in a block; the default keeps the data of a
+         * block well within the L1 cache.
+         */
+        int blockSize = 64;
+
+        /**
+         * Bind the pass to the simulation.
+         * @param simulation Simulation to bind to.
+         */
+        void bind(Simulation& simulation) override {
+            Force::bind(simulation);
+
+            std::apply([&](auto*... term) -> void {
+                (markFused(term), ...);
+            }, terms);
+        }
+
+        /**
+         * Asynchronous part of the force computation, i.e. the fused pass.
+         * @param dynamics Dynamics object to add potential energy and forces
+         * to.
+         */
+        void asyncPart(Dynamics& dynamics) override {
+            int n = state->n;
+
+            #pragma omp for schedule(static) nowait
+            for (int begin = 0; begin < n; begin += blockSize) {
+                int end = std::min(begin + blockSize, n);
+                (std::get<Terms*>(terms)->Terms::blockPart(begin, end,
+                    dynamics), ...);
+            }
+        }
+
+    private:
+        /**
+         * Forces evaluated in the pass.
+         */
+        std::tuple<Terms*...> terms;
+
+        static void markFused(BondedForce* term) {
+            if (term->fused) {
+                throw std::runtime_error("The bonded force is already fused");
+            }
+            term->fused = true;
+        }
+    };
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include "NonlocalForce.hpp"
+#include "../data/Chains.hpp"
+
+namespace mdk {
+    /**
+     * A fused pass over the pairs of residues for a number of nonlocal
+     * forces (the "terms"). Normally each nonlocal force goes through its own
+     * sublist of the Verlet list, so that a pair of residues present in
+     * several of them has its (PBC-adjusted) distance computed several times
+     * per step. Here, the terms are taken out of the Verlet list, which
+     * instead contains a single sublist for the least restrictive of their
+     * specs; the pass goes through it once, computes the distance and the
+     * normalized vector for each pair, and invokes every term whose spec the
+     * pair satisfies (see \p NonlocalForce::fusedPairPart).
+     *
+     * Only the forces which are sums of the pairwise terms over their
+     * sublists, with no state kept between the steps, may be fused (see
+     * \p NonlocalForce::fusible): the Pauli exclusion (with the Verlet list),
+     * the Debye-Hueckel potentials and the pseudo-improper-dihedral
+     * potential. The fused pass is added to the simulation after the terms;
+     * note that the contributions of the terms are then summed in a
+     * different order, so the results may differ up to rounding.
+     */
+    class FusedNonlocal: public NonlocalForce {
+    public:
+        /**
+         * Construct the pass.
+         * @tparam Forces Types of the forces to fuse.
+         * @param forces Forces to fuse, already added to the simulation.
+         */
+        template<typename... Forces>
+        explicit FusedNonlocal(Forces&... forces):
+            terms { static_cast<NonlocalForce*>(&forces)... } {};
+
+        /**
+         * Bind the pass to the simulation: here the terms are unregistered
+         * from the Verlet list, and the pass is registered in their stead.
+         * @param simulation Simulation to bind to.
+         */
+        void bind(Simulation& simulation) override;
+
+        /**
+         * Asynchronous part of the force computation, i.e. the fused pass.
+         * @param dynamics Dynamics object to add potential energy and forces
+         * to.
+         */
+        void asyncPart(Dynamics& dynamics) override;
+
+        /**
+         * An action to be performed when the Verlet list is updated; nothing
+         * needs to be done, as we iterate over the sublist directly.
+         */
+        void vlUpdateHook() override;
+
+    protected:
+        /**
+         * Generate a VL spec, i.e. the least restrictive of the specs of the
+         * terms.
+         * @return Generated VL spec.
+         */
+        vl::Spec spec() const override;
+
+    private:
+        /**
+         * Forces evaluated in the pass.
+         */
+        std::vector<NonlocalForce*> terms;
+
+        Chains const* chains = nullptr;
+    };
+}
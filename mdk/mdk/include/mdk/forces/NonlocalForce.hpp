@@ -10,6 +10,8 @@ namespace mdk {
      * needs to implement a hook to run when a VL list is updated.
      */
     class NonlocalForce: public Force {
+        friend class FusedNonlocal;
+
     protected:
         /**
          * A copy of the generated \p spec(), for use in the computation of
@@ -24,10 +26,10 @@ namespace mdk {
         virtual vl::Spec spec() const = 0;
 
         /**
-         * A pointer to the VL list. It's not const chiefly because the update
-         * hooks may modify the list, in particular create exclusions, like
-         * for example the native contacts' forcefield removing the native
-         * contacts
+         * A pointer to the VL list. It's not const chiefly because the forces
+         * may modify the list, in particular register exclusions, like for
+         * example the native contacts' forcefield excluding the native
+         * contacts.
          */
         vl::List *vl = nullptr;
 
@@ -38,6 +40,49 @@ namespace mdk {
          */
         void installIntoVL();
 
+        /**
+         * Index of the sublist of the Verlet list associated with the spec
+         * of this force.
+         */
+        int vlIdx = -1;
+
+        /**
+         * Access the sublist of the Verlet list containing the candidate
+         * pairs for this force, i.e. satisfying its spec.
+         * @return Reference to the sublist.
+         */
+        vl::NeighbourList& vlPairs() {
+            return vl->sublists[vlIdx];
+        }
+
+        /**
+         * Whether the force is evaluated in a fused pass (see
+         * \p FusedNonlocal) rather than in its own \p asyncPart; it's then
+         * not registered in the Verlet list, and \p asyncPart does nothing.
+         */
+        bool fused = false;
+
+        /**
+         * Whether the force may be evaluated in a fused pass, i.e. it's a sum
+         * of the terms for the pairs in its sublist (with no state kept
+         * between the steps), implemented by \p fusedPairPart.
+         * @return Whether the force may be fused.
+         */
+        virtual bool fusible() const;
+
+        /**
+         * Computes the force for a single pair of residues, in a fused pass.
+         * The pair satisfies the spec of the force, i.e. the residues are
+         * separated by at least \p vl::Spec::minBondSep bonds, the pair is
+         * not excluded, and the distance is within the cutoff distance.
+         * @param pair Pair of residues, with the distance and the
+         * (PBC-adjusted) normalized vector between them.
+         * @param dynamics Dynamics object to add potential energy and forces
+         * to.
+         */
+        virtual void fusedPairPart(vl::PairInfo const& pair,
+            Dynamics& dynamics) const;
+
     public:
         /**
          * Bind the nonlocal force to the simulation object. This class
@@ -50,8 +95,9 @@ namespace mdk {
         /**
          * An action to be performed when Verlet list is updated; usually one
          * copies the relevant pairs into a local list, perhaps with some
-         * modifications. The actions are invoked in the order of being
-         * added to the Verlet list.
+         * modifications. The hooks only read the Verlet list, so they are
+         * invoked concurrently, as OpenMP tasks, and may themselves spawn
+         * tasks (see \p vl::NeighbourList::forEachChunk).
          */
         virtual void vlUpdateHook() = 0;
     };
@@ -0,0 +1,248 @@
+#pragma once
+#include "../system/State.hpp"
+#include "../verlet/NeighbourList.hpp"
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+namespace mdk {
+    /**
+     * A pair filter accepting all the pairs.
+     */
+    struct AllPairs {
+        inline bool operator()(int i1, int i2) const {
+            return true;
+        }
+    };
+
+    /**
+     * A generic engine computing a pairwise force, given by a kernel (see
+     * the \p kernels directory), for a list of pairs of residues. The pairs
+     * are processed in batches of \p batchSize, stored as separate arrays
+     * (of the indices, the coordinates of the distance vectors etc.): the
+     * positions of the residues are gathered and the (PBC-adjusted)
+     * distances are computed for the whole batch at once; the pairs within
+     * the cutoff distance which are accepted by the filter are then
+     * compacted, and the potential and its derivative are computed for all
+     * of them at once as well, both in loops amenable to vectorization; only
+     * then are the forces added to the residues. If the library is built with
+     * MIXED_PRECISION, the positions are gathered from the single-precision
+     * copy in \p State (from the separate arrays of the coordinates), and
+     * the distances are computed in single precision; the forces using it
+     * must request the copy with \p State::useShadow at the binding.
+     *
+     * The pairs are distributed among the threads of the enclosing parallel
+     * region (with an orphaned \p omp \p for, without a barrier), so the
+     * functions are to be invoked by all the threads, in \p asyncPart
+     * (except for \p computeBatch, which works on a single batch).
+     * @tparam Kernel Type of the kernel, i.e. a class with a method
+     * computeV(norm, V, dV_dn), and the sign of the force \p forceSign: the
+     * force on the first residue is forceSign * dV_dn * unit, where unit is
+     * the unit vector from the second residue to the first one. The kernels
+     * of the pairs are copied, unless they're not trivially copyable (as
+     * \p TabulatedKernel), in which case they're referred to, and the
+     * functions returning them must return references.
+     * @tparam Filter Type of the filter, i.e. a predicate taking the indices
+     * of the residues of a pair.
+     */
+    template<typename Kernel, typename Filter = AllPairs>
+    class PairForce {
+    public:
+        /**
+         * Number of pairs in a batch.
+         */
+        static constexpr int batchSize = 8;
+
+        /**
+         * Square of the cutoff distance.
+         */
+        double cutoffSq = 0.0;
+
+        /**
+         * Filter of the pairs, applied to the pairs within the cutoff
+         * distance.
+         */
+        Filter filter;
+
+        PairForce() = default;
+        explicit PairForce(double cutoffSq, Filter filter = Filter()):
+            cutoffSq(cutoffSq), filter(std::move(filter)) {};
+
+        /**
+         * Computes the forces for a list of pairs, with a separate kernel for
+         * every pair (for example with the parameters of a contact).
+         * @param pairs List of the pairs, i.e. of the structures with the
+         * indices of the residues in fields \p i1 and \p i2.
+         * @param kernelOf Function taking a pair and returning the kernel
+         * for it (or a reference to it).
+         * @param state State of the simulation.
+         * @param dyn Dynamics object to add potential energy and forces to.
+         */
+        template<typename Pair, typename KernelOf>
+        void compute(std::vector<Pair> const& pairs, KernelOf const& kernelOf,
+            State const& state, Dynamics& dyn) const {
+
+            int numPairs = (int)pairs.size();
+            int numBatches = (numPairs + batchSize - 1) / batchSize;
+
+            #pragma omp for nowait
+            for (int batch = 0; batch < numBatches; ++batch) {
+                int first = batch * batchSize;
+                int count = std::min(batchSize, numPairs - first);
+
+                int i1[batchSize], i2[batchSize];
+                for (int b = 0; b < count; ++b) {
+                    i1[b] = pairs[first + b].i1;
+                    i2[b] = pairs[first + b].i2;
+                }
+
+                computeBatch(count, i1, i2, state, dyn,
+                    [&](int b) -> decltype(auto) {
+                        return kernelOf(pairs[first + b]);
+                    });
+            }
+        }
+
+        /**
+         * Computes the forces for the pairs in a neighbour list, with the
+         * same kernel for all the pairs.
+         * @param pairs Neighbour list.
+         * @param kernel Kernel of the force.
+         * @param state State of the simulation.
+         * @param dyn Dynamics object to add potential energy and forces to.
+         */
+        void compute(vl::NeighbourList const& pairs, Kernel const& kernel,
+            State const& state, Dynamics& dyn) const {
+
+            #pragma omp for schedule(dynamic, 64) nowait
+            for (int i = 0; i < pairs.numRows(); ++i) {
+                int i1[batchSize];
+                std::fill(i1, i1 + batchSize, i);
+
+                int end = pairs.offsets[i+1];
+                for (int k = pairs.offsets[i]; k < end; k += batchSize) {
+                    int count = std::min(batchSize, end - k);
+                    computeBatch(count, i1, &pairs.js[k], state, dyn,
+                        [&](int b) -> Kernel const& {
+                            return kernel;
+                        });
+                }
+            }
+        }
+
+        /**
+         * Computes the forces for a batch of pairs.
+         * @param count Number of the pairs in the batch, at most
+         * \p batchSize.
+         * @param i1 Indices of the first residues of the pairs.
+         * @param i2 Indices of the second residues of the pairs.
+         * @param state State of the simulation.
+         * @param dyn Dynamics object to add potential energy and forces to.
+         * @param kernelAt Function taking the index of a pair in the batch
+         * and returning the kernel for it (or a reference to it).
+         * @param norms If not null, an array to which the distances of the
+         * pairs are written (for the pairs within the cutoff distance and
+         * accepted by the filter).
+         */
+        template<typename KernelAt>
+        void computeBatch(int count, int const* i1, int const* i2,
+            State const& state, Dynamics& dyn, KernelAt const& kernelAt,
+            double* norms = nullptr) const {
+
+#ifdef MIXED_PRECISION
+            Real const* r[3] = { state.rShadow.row(0).data(),
+                state.rShadow.row(1).data(), state.rShadow.row(2).data() };
+#else
+            auto const& r = state.r;
+#endif
+
+            /* The minimum image convention, without branches: along the
+             * non-periodic axes, the (inverse) cell size is set to zero. The
+             * rounding is done by a conversion to an integer, which, unlike
+             * std::rint, vectorizes without SSE4.1.
+             */
+            Real cell[3], cellInv[3];
+            for (int dim = 0; dim < 3; ++dim) {
+                cell[dim] = state.top.use[dim] ? state.top.cell[dim] : 0.0;
+                cellInv[dim] = state.top.use[dim] ? state.top.cellInv[dim] : 0.0;
+            }
+
+            /* The unused slots of an incomplete batch, and the pairs rejected
+             * by the filter, are masked out by a negative square of the
+             * cutoff distance, so that the whole batch can be processed
+             * uniformly.
+             */
+            Real r12[3][batchSize], x2[batchSize], limit[batchSize];
+            for (int b = 0; b < batchSize; ++b) {
+                for (int dim = 0; dim < 3; ++dim) {
+#ifdef MIXED_PRECISION
+                    r12[dim][b] = b < count ? r[dim][i1[b]] - r[dim][i2[b]] : 0.0;
+#else
+                    r12[dim][b] = b < count ? r(dim, i1[b]) - r(dim, i2[b]) : 0.0;
+#endif
+                }
+                bool accepted = b < count && filter(i1[b], i2[b]);
+                limit[b] = accepted ? cutoffSq : -1.0;
+            }
+
+            #pragma omp simd
+            for (int b = 0; b < batchSize; ++b) {
+                Real norm2 = 0.0;
+                for (int dim = 0; dim < 3; ++dim) {
+                    auto d = r12[dim][b], s = d * cellInv[dim];
+                    d -= (Real)(int)(s + std::copysign(Real(0.5), s)) * cell[dim];
+                    r12[dim][b] = d;
+                    norm2 += d * d;
+                }
+                x2[b] = norm2;
+            }
+
+            /* The pairs within the cutoff distance (and accepted by the
+             * filter) are compacted, without branches, along with their
+             * distances and kernels, and the kernels are evaluated for them
+             * only, as most of the pairs in a padded list lie beyond the
+             * cutoff distance.
+             */
+            constexpr bool byValue = std::is_trivially_copyable_v<Kernel>;
+            using KernelSlot = std::conditional_t<byValue, Kernel,
+                Kernel const*>;
+
+            int numInside = 0, slot[batchSize];
+            Real x2In[batchSize];
+            KernelSlot kernels[batchSize];
+            for (int b = 0; b < count; ++b) {
+                slot[numInside] = b;
+                x2In[numInside] = x2[b];
+                if constexpr (byValue)
+                    kernels[numInside] = kernelAt(b);
+                else
+                    kernels[numInside] = &kernelAt(b);
+                numInside += x2[b] <= limit[b];
+            }
+
+            double x[batchSize], V[batchSize], dV_dn[batchSize];
+
+            #pragma omp simd
+            for (int k = 0; k < numInside; ++k) {
+                x[k] = std::sqrt(x2In[k]);
+
+                double V_k = 0.0, dV_dn_k = 0.0;
+                if constexpr (byValue)
+                    kernels[k].computeV(x[k], V_k, dV_dn_k);
+                else
+                    kernels[k]->computeV(x[k], V_k, dV_dn_k);
+                V[k] = V_k;
+                dV_dn[k] = dV_dn_k;
+            }
+
+            for (int k = 0; k < numInside; ++k) {
+                auto b = slot[k];
+                Vector unit = Vector(r12[0][b], r12[1][b], r12[2][b]) / x[k];
+                dyn.V += V[k];
+                dyn.F[i1[b]] += Kernel::forceSign * dV_dn[k] * unit;
+                dyn.F[i2[b]] -= Kernel::forceSign * dV_dn[k] * unit;
+                if (norms) norms[b] = x[k];
+            }
+        }
+    };
+}
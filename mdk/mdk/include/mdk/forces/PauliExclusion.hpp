@@ -2,6 +2,7 @@
 #include "NonlocalForce.hpp"
 #include "../kernels/ShiftedTruncatedLJ.hpp"
 #include "../data/Chains.hpp"
+#include "../verlet/CellGrid.hpp"
 
 namespace mdk {
     /**
@@ -9,13 +10,46 @@ namespace mdk {
      */
     class PauliExclusion: public NonlocalForce {
     public:
+        /**
+         * Way of finding the pairs of residues within the cutoff distance.
+         */
+        enum class Mode {
+            /// Go through the sublist of the Verlet list.
+            VERLET_LIST,
+            /**
+             * Place the residues into a grid of cells of size (roughly)
+             * equal to the cutoff distance at every step, and go through
+             * the pairs of neighbouring cells, without storing any list of
+             * pairs. The force is then not registered in the Verlet list at
+             * all, so the list can be tuned for the longer-range forces
+             * alone. As the cutoff distance is very short, the number of
+             * candidate pairs per residue is small, so that binning the
+             * residues anew at every step may be cheaper than maintaining
+             * (and going through) the padded list.
+             *
+             * The pairs are computed entirely on the residues reordered by
+             * the cell (i.e. in space): the positions are taken from the
+             * cell-ordered copy (\p vl::CellGrid::cellR) and the forces are
+             * accumulated in the same order, and only then added to the
+             * forces of the residues, through the map \p
+             * vl::CellGrid::cellIdx, in a single pass.
+             */
+            CELL_DIRECT
+        };
+
         /**
          * A shifted and truncated version of the Lennard-Jones potential
          * that is used as the actual force.
          */
         ShiftedTruncatedLJ stlj;
 
-        PauliExclusion();
+        /**
+         * Construct the force.
+         * @param mode Way of finding the pairs of residues; it cannot be
+         * changed afterwards, since it decides whether the force is
+         * registered in the Verlet list.
+         */
+        explicit PauliExclusion(Mode mode = Mode::VERLET_LIST);
 
         /**
          * Bind the object to the simulation.
@@ -32,7 +66,8 @@ namespace mdk {
 
         /**
          * An action performed when a Verlet list is reconstructed; here we
-         * simply copy the list verbatim.
+         * need not do anything, as the force iterates over its sublist of
+         * the Verlet list directly.
          */
         void vlUpdateHook() override;
 
@@ -43,10 +78,41 @@ namespace mdk {
          */
         vl::Spec spec() const override;
 
+        /**
+         * The force may be fused only in \p Mode::VERLET_LIST.
+         * @return Whether the force may be fused.
+         */
+        bool fusible() const override;
+
+        /**
+         * Computes the force for a single pair of residues, in a fused pass.
+         * @param pair Pair of residues.
+         * @param dynamics Dynamics object to add potential energy and forces
+         * to.
+         */
+        void fusedPairPart(vl::PairInfo const& pair,
+            Dynamics& dynamics) const override;
+
     private:
+        Mode mode;
+
+        Chains const* chains = nullptr;
+
+        /**
+         * Grid of cells, rebuilt at every step, in \p Mode::CELL_DIRECT.
+         */
+        vl::CellGrid cells;
+
         /**
-         * A local copy of the Verlet list.
+         * Computes the forces for the pairs of residues from two cells (or,
+         * if \p c1 = \p c2, within a single cell), in
+         * \p Mode::CELL_DIRECT.
+         * @param c1 Index of the first cell.
+         * @param c2 Index of the second cell.
+         * @param V Potential energy to add to.
+         * @param cellF Forces to add to, in the order of the residues in
+         * \p cells (see \p vl::CellGrid::cellIdx).
          */
-        Pairs exclPairs;
+        void perCellPair(int c1, int c2, double& V, Vectors& cellF);
     };
 }
@@ -5,6 +5,7 @@
 #include "../data/Types.hpp"
 #include "../data/Chains.hpp"
 #include "../utils/AminoAcid.hpp"
+#include "../system/ChainGeometry.hpp"
 
 namespace mdk {
     /**
@@ -56,7 +57,8 @@ namespace mdk {
         /**
          * Derive the angle data (specifically the angles and derivatives)
          * pertaining to the pair.
-         * @param pair Pair of residues.
+         * @param pair Pair of residues, with the original indices (see
+         * \p State::origIdx).
          * @param psi An array, where psi[0] is the improper dihedral angle
          * between i_1-1, i_1, i_1+1 and i_2, and psi[1] is the improper dihedral
          * angle between i_2-1, i_2, i_2+1 and i_1.
@@ -68,6 +70,15 @@ namespace mdk {
         void deriveAngles(vl::PairInfo const& pair, double psi[2],
             Vector dpsi_dr[2][6]) const;
 
+        /**
+         * Computes the force for a single pair of residues (not at the ends
+         * of their chains) within the cutoff distance.
+         * @param pair Pair of residues, with the storage indices.
+         * @param dynamics Dynamics object to add potential energy and forces
+         * to.
+         */
+        void pairPart(vl::PairInfo const& pair, Dynamics& dynamics) const;
+
         /**
          * A const pointer to the types of the residues.
          */
@@ -78,6 +89,11 @@ namespace mdk {
          */
         Chains const* seqs = nullptr;
 
+        /**
+         * A const pointer to the geometry of the chains (the bond vectors).
+         */
+        ChainGeometry const* geometry = nullptr;
+
     public:
         /**
          * Lambda function corresponding to the bb+ part of the potential.
@@ -127,9 +143,11 @@ namespace mdk {
         void asyncPart(Dynamics &dynamics) override;
 
         /**
-         * An action to be performed when the Verlet list is updated. We
-         * essentially copy the residues but exclude the pairs within bond
-         * distance of less than 4, or at the ends of their chains.
+         * An action to be performed when the Verlet list is updated. Nothing
+         * needs to be done, as we iterate over the sublist of the Verlet list
+         * directly: the pairs within bond distance of less than 4 are
+         * excluded by the spec, and the ones at the ends of their chains are
+         * skipped during the computation.
          */
         void vlUpdateHook() override;
 
@@ -140,11 +158,20 @@ namespace mdk {
          */
         vl::Spec spec() const override;
 
-    private:
         /**
-         * Local copy of the Verlet list with some pairs potentially excluded
-         * (see \p vlUpdateHook for details).
+         * The potential may be fused; the pairs at the ends of their chains
+         * are then skipped in \p fusedPairPart.
+         * @return Whether the force may be fused.
+         */
+        bool fusible() const override;
+
+        /**
+         * Computes the force for a single pair of residues, in a fused pass.
+         * @param pair Pair of residues.
+         * @param dynamics Dynamics object to add potential energy and forces
+         * to.
          */
-        Pairs pairs;
+        void fusedPairPart(vl::PairInfo const& pair,
+            Dynamics& dynamics) const override;
     };
 }
@@ -1,5 +1,5 @@
 #pragma once
-#include "Force.hpp"
+#include "BondedForce.hpp"
 #include "../kernels/Harmonic.hpp"
 #include "../data/Chains.hpp"
 
@@ -7,7 +7,7 @@ namespace mdk {
     /**
      * Harmonic tether forces between consecutive residues in a chain.
      */
-    class Tether: public Force {
+    class Tether: public BondedForce {
     public:
         /**
          * Construct a \p Tether object.
@@ -31,6 +31,16 @@ namespace mdk {
          */
         void asyncPart(Dynamics &dynamics) override;
 
+        /**
+         * Computes the terms of the force associated with a block of
+         * residues (see \p BondedForce::blockPart).
+         * @param begin Index of the first residue of the block.
+         * @param end Index past the last residue of the block.
+         * @param dynamics Dynamics object to add potential energy and forces
+         * to.
+         */
+        void blockPart(int begin, int end, Dynamics& dynamics) const override;
+
     private:
         /**
          * The underlying harmonic force kernel. It is separated from this class
@@ -61,5 +71,14 @@ namespace mdk {
          * is tethered; 0 otherwise.
          */
         Bytes isConnected;
+
+        /**
+         * Computes the term of the force associated with a given residue, i.e.
+         * the tether between the residues i and i+1.
+         * @param i Index of the residue.
+         * @param dynamics Dynamics object to add potential energy and forces
+         * to.
+         */
+        void residuePart(int i, Dynamics& dynamics) const;
     };
 }
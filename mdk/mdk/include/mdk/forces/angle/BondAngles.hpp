@@ -1,6 +1,7 @@
 #pragma once
-#include "../Force.hpp"
+#include "../BondedForce.hpp"
 #include "../../data/Primitives.hpp"
+#include "../../system/ChainGeometry.hpp"
 #include "HeuresticBA.hpp"
 #include "NativeBA.hpp"
 
@@ -10,7 +11,7 @@ namespace mdk {
      * depending on whether a triple has an associated native bond angle (in
      * such cases the native variant supercedes the heurestic variant).
      */
-    class BondAngles: public Force {
+    class BondAngles: public BondedForce {
     private:
         friend class HeuresticBA;
         /// The "heurestic" part of the potential.
@@ -23,6 +24,52 @@ namespace mdk {
         /// Whether a triple (i-1, i, i+1) is connected, i.e. in one chain.
         Bytes inRange;
 
+        /// Bond vectors and their cross products.
+        ChainGeometry const* geometry = nullptr;
+
+        /**
+         * Parameters of the potential for a single triple. They are gathered
+         * from the parts into a dense array indexed by the triple, so that
+         * the computation needs neither to choose the part (both variants
+         * are evaluated, and one is selected) nor to look up the type of
+         * the triple.
+         */
+        struct Record {
+            /**
+             * Coefficients of the heurestic polynomial, or zeros if there is
+             * no heurestic part.
+             */
+            double coeff[HeuresticBA::D+1];
+
+            /// Native bond angle.
+            double theta0;
+
+            /// Whether the native variant applies to the triple.
+            bool native;
+        };
+
+        /// Parameters of the potential for the triples.
+        std::vector<Record> records;
+
+        /// The coefficient of the native variant.
+        double CBA = 0.0;
+
+        /**
+         * Gather the parameters of the parts into \p records; invoked when
+         * the force is bound (with no parts yet, which zeroes the records),
+         * and by the parts as they are bound.
+         */
+        void updateRecords();
+
+        /**
+         * Computes the term of the force associated with a given residue, i.e.
+         * the angle of the triple (i-1, i, i+1).
+         * @param i Index of the residue.
+         * @param dynamics Dynamics object to add potential energy and forces
+         * to.
+         */
+        void residuePart(int i, Dynamics& dynamics) const;
+
     public:
         /**
          * Bind the force field to a simulation.
@@ -35,5 +82,15 @@ namespace mdk {
          * @param dynamics Dynamics object to add potential energy and forces to.
          */
         void asyncPart(Dynamics &dynamics) override;
+
+        /**
+         * Computes the terms of the force associated with a block of
+         * residues (see \p BondedForce::blockPart).
+         * @param begin Index of the first residue of the block.
+         * @param end Index past the last residue of the block.
+         * @param dynamics Dynamics object to add potential energy and forces
+         * to.
+         */
+        void blockPart(int begin, int end, Dynamics& dynamics) const override;
     };
 }
@@ -42,7 +42,20 @@ namespace mdk {
          * to add to.
          */
         void term(int i, double theta, double& V, double& dV_dth) const {
-            double const* coeffs = coeff[angleTypes[i]];
+            eval(coeff[angleTypes[i]], theta, V, dV_dth);
+        }
+
+        /**
+         * Evaluate the polynomial of the potential with given coefficients.
+         * @param coeffs Coefficients of the polynomial (D+1 of them).
+         * @param theta Value of the bond angle.
+         * @param V Potential energy reference to add to.
+         * @param dV_dth Derivative of potential energy wrt the angle theta
+         * to add to.
+         */
+        static void eval(double const* coeffs, double theta, double& V,
+            double& dV_dth) {
+
             double V_loc = 0.0;
             double dV_dth_loc = 0.0;
             // Here we compute the polynomial with Horner scheme.
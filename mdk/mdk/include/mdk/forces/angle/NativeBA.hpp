@@ -46,7 +46,22 @@ namespace mdk {
          * to add to.
          */
         void term(int i, double theta, double& V, double& dV_dth) const {
-            auto diff = theta - theta0[i];
+            eval(CBA, theta0[i], theta, V, dV_dth);
+        }
+
+        /**
+         * Evaluate the potential with given parameters.
+         * @param CBA Coefficient of the potential.
+         * @param theta0 Native bond angle.
+         * @param theta Value of the bond angle.
+         * @param V Potential energy reference to add to.
+         * @param dV_dth Derivative of potential energy wrt the angle theta
+         * to add to.
+         */
+        static void eval(double CBA, double theta0, double theta, double& V,
+            double& dV_dth) {
+
+            auto diff = theta - theta0;
             V += CBA * diff * diff;
             dV_dth += 2.0 * CBA * diff;
         }
@@ -31,7 +31,18 @@ namespace mdk {
          * to add to.
          */
         void term(int i, double phi, double& V, double& dV_dphi) const {
-            double _phi0 = phi0[i];
+            eval(phi0[i], phi, V, dV_dphi);
+        }
+
+        /**
+         * Evaluate the formula for a given native dihedral angle.
+         * @param _phi0 Native dihedral angle.
+         * @param phi Value of the dihedral angle.
+         * @param V Potential energy reference to add to.
+         * @param dV_dphi Derivative of potential energy wrt the angle phi
+         * to add to.
+         */
+        void eval(double _phi0, double phi, double& V, double& dV_dphi) const {
 
             V += CDA * (1.0 - cos(phi - _phi0)) +
                  CDB * (1.0 - cos(3.0 * (phi - _phi0)));
@@ -39,5 +50,31 @@ namespace mdk {
             dV_dphi += CDA * sin(phi - _phi0) +
                        3.0 * CDB * sin(3.0 * (phi - _phi0));
         }
+
+        /**
+         * Evaluate the formula from the cosines and the sines of the dihedral
+         * angle and of the native dihedral angle, without trigonometric
+         * functions: the cosine and the sine of the difference are obtained
+         * from the angle subtraction formulas, and of the triple difference
+         * from the triple angle formulas.
+         * @param cos_phi0 Cosine of the native dihedral angle.
+         * @param sin_phi0 Sine of the native dihedral angle.
+         * @param cos_phi Cosine of the dihedral angle.
+         * @param sin_phi Sine of the dihedral angle.
+         * @param V Potential energy reference to add to.
+         * @param dV_dphi Derivative of potential energy wrt the angle phi
+         * to add to.
+         */
+        void eval(double cos_phi0, double sin_phi0, double cos_phi,
+            double sin_phi, double& V, double& dV_dphi) const {
+
+            double cos_diff = cos_phi * cos_phi0 + sin_phi * sin_phi0;
+            double sin_diff = sin_phi * cos_phi0 - cos_phi * sin_phi0;
+            double cos_3_diff = cos_diff * (4.0 * cos_diff * cos_diff - 3.0);
+            double sin_3_diff = sin_diff * (3.0 - 4.0 * sin_diff * sin_diff);
+
+            V += CDA * (1.0 - cos_diff) + CDB * (1.0 - cos_3_diff);
+            dV_dphi += CDA * sin_diff + 3.0 * CDB * sin_3_diff;
+        }
     };
 }
\ No newline at end of file
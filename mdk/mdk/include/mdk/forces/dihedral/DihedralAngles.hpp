@@ -1,6 +1,7 @@
 #pragma once
-#include "../Force.hpp"
+#include "../BondedForce.hpp"
 #include "../../data/Primitives.hpp"
+#include "../../system/ChainGeometry.hpp"
 #include "ComplexNativeDihedral.hpp"
 #include "SimpleNativeDihedral.hpp"
 #include "HeuresticDihedral.hpp"
@@ -15,7 +16,7 @@ namespace mdk {
      * The native part supercedes heurestic part whenever native dihedral angle
      * is defined for a quadruple.
      */
-    class DihedralAngles: public Force {
+    class DihedralAngles: public BondedForce {
     private:
         friend class ComplexNativeDihedral;
         friend class SimpleNativeDihedral;
@@ -32,6 +33,56 @@ namespace mdk {
 
         Bytes inRange;
 
+        /// Bond vectors and their cross products.
+        ChainGeometry const* geometry = nullptr;
+
+        /**
+         * Parameters of the potential for a single quadruple, gathered from
+         * the parts into a dense array indexed by the quadruple, so that
+         * the computation doesn't need to look up the type of the quadruple
+         * or check for the presence of the heurestic part.
+         */
+        struct Record {
+            /**
+             * Coefficients of the heurestic formula, or zeros if there is
+             * no heurestic part.
+             */
+            double C[6];
+
+            /**
+             * Native dihedral angle (undefined if there is no native part,
+             * or the quadruple has no native angle).
+             */
+            double phi0;
+
+            /// Cosine and sine of the native dihedral angle.
+            double cos_phi0, sin_phi0;
+        };
+
+        /// Parameters of the potential for the quadruples.
+        std::vector<Record> records;
+
+        /**
+         * Gather the parameters of the parts into \p records; invoked when
+         * the force is bound (with no parts yet, which zeroes the records),
+         * and by the parts as they are bound.
+         */
+        void updateRecords();
+
+        /**
+         * Computes the term for a quadruple with a given variant of the
+         * native part, so that the variant is checked once per pass rather
+         * than for every quadruple.
+         * @tparam Native Type of the native part (\p std::monostate if
+         * there's none).
+         * @param i Index of the residue.
+         * @param natPart Native part.
+         * @param dynamics Dynamics object to add potential energy and forces
+         * to.
+         */
+        template<typename Native>
+        void perQuad(int i, Native natPart, Dynamics& dynamics) const;
+
     public:
         /**
          * Bind the force field to a simulation.
@@ -44,5 +95,15 @@ namespace mdk {
          * @param dynamics Dynamics object to add potential energy and forces to.
          */
         void asyncPart(Dynamics &dynamics) override;
+
+        /**
+         * Computes the terms of the force associated with a block of
+         * residues (see \p BondedForce::blockPart).
+         * @param begin Index of the first residue of the block.
+         * @param end Index past the last residue of the block.
+         * @param dynamics Dynamics object to add potential energy and forces
+         * to.
+         */
+        void blockPart(int begin, int end, Dynamics& dynamics) const override;
     };
 }
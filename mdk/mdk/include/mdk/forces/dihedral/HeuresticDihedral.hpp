@@ -43,12 +43,40 @@ namespace mdk {
          * to add to.
          */
         void term(int i, double phi, double& V, double& dV_dphi) const {
-            double sin_phi = sin(phi), cos_phi = cos(phi);
+            eval(coeff[angleTypes[i]], phi, V, dV_dphi);
+        }
+
+        /**
+         * Evaluate the formula with given coefficients.
+         * @param C Coefficients of the formula (6 of them).
+         * @param phi Value of the dihedral angle.
+         * @param V Potential energy reference to add to.
+         * @param dV_dphi Derivative of potential energy wrt the angle phi
+         * to add to.
+         */
+        static void eval(double const* C, double phi, double& V,
+            double& dV_dphi) {
+
+            eval(C, cos(phi), sin(phi), V, dV_dphi);
+        }
+
+        /**
+         * Evaluate the formula with given coefficients, from the cosine and
+         * the sine of the dihedral angle -- the formula depends on the angle
+         * only through these, so the angle itself needn't be computed.
+         * @param C Coefficients of the formula (6 of them).
+         * @param cos_phi Cosine of the dihedral angle.
+         * @param sin_phi Sine of the dihedral angle.
+         * @param V Potential energy reference to add to.
+         * @param dV_dphi Derivative of potential energy wrt the angle phi
+         * to add to.
+         */
+        static void eval(double const* C, double cos_phi, double sin_phi,
+            double& V, double& dV_dphi) {
+
             double sin_2_phi = sin_phi * sin_phi;
             double cos_2_phi = cos_phi * cos_phi;
 
-            double const* C = coeff[angleTypes[i]];
-
             V += C[0]
                + C[1] * sin_phi
                + C[2] * cos_phi
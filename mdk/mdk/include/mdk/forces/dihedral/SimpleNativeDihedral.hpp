@@ -30,7 +30,19 @@ namespace mdk {
          * to add to.
          */
         void term(int i, double phi, double& V, double& dV_dphi) const {
-            auto diff = phi - phi0[i];
+            eval(phi0[i], phi, V, dV_dphi);
+        }
+
+        /**
+         * Evaluate the formula for a given native dihedral angle.
+         * @param _phi0 Native dihedral angle.
+         * @param phi Value of the dihedral angle.
+         * @param V Potential energy reference to add to.
+         * @param dV_dphi Derivative of potential energy wrt the angle phi
+         * to add to.
+         */
+        void eval(double _phi0, double phi, double& V, double& dV_dphi) const {
+            auto diff = phi - _phi0;
             V += 0.5 * CDH * diff * diff;
             dV_dphi += CDH * diff;
         }
@@ -1,5 +1,7 @@
 #pragma once
 #include "ESBase.hpp"
+#include "../../kernels/DebyeHueckel.hpp"
+#include "../../kernels/TabulatedKernel.hpp"
 
 namespace mdk {
     /**
@@ -14,14 +16,56 @@ namespace mdk {
          */
         vl::Spec spec() const override;
 
+        /**
+         * Computes the force for a single pair of residues, in a fused pass.
+         * @param pair Pair of residues.
+         * @param dynamics Dynamics object to add potential energy and forces
+         * to.
+         */
+        void fusedPairPart(vl::PairInfo const& pair,
+            Dynamics& dynamics) const override;
+
     public:
         double screeningDist = 10.0 * angstrom;
         double permittivity = 80.0 * epsilon_0;
 
+        /**
+         * Whether the potential is evaluated from tables (see
+         * \p TabulatedKernel) rather than directly. The tables span the
+         * distances from \p tableMinDist to the screening distance (the
+         * closer pairs are evaluated directly); they are created at the
+         * first update of the Verlet list, from the parameters at that time.
+         */
+        bool tabulated = false;
+
+        /// Lower bound of the distances in the tables.
+        double tableMinDist = 3.0 * angstrom;
+
+        /**
+         * An action to be performed when the Verlet list is updated: besides
+         * filtering the list (see \p ESBase::vlUpdateHook), the tables are
+         * created here, if they're used.
+         */
+        void vlUpdateHook() override;
+
         /**
          * Asynchronous part of the force computation.
          * @param dynamics Dynamics object to add potential energy and forces to.
          */
         void asyncPart(Dynamics &dynamics) override;
+
+    private:
+        /**
+         * Tables of the potential for the pairs of residues with the
+         * opposite and with the same charges, respectively.
+         */
+        TabulatedKernel<DebyeHueckel> tables[2];
+
+        /**
+         * The kernel of the potential for a pair of residues.
+         * @param q1_x_q2 Product of the charges of the residues.
+         * @return The kernel.
+         */
+        DebyeHueckel kernel(double q1_x_q2) const;
     };
 }
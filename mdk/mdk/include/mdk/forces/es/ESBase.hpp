@@ -33,6 +33,13 @@ namespace mdk {
          */
         Eigen::Matrix<int8_t, Eigen::Dynamic, 1> charge;
 
+        /**
+         * The potentials may be fused; the charges are then looked up for
+         * each pair in \p fusedPairPart.
+         * @return Whether the force may be fused.
+         */
+        bool fusible() const override;
+
     public:
         /**
          * Bind the class to the simulation. It initializes \p charge and adds
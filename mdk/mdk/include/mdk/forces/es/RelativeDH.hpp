@@ -14,6 +14,15 @@ namespace mdk {
          */
         vl::Spec spec() const override;
 
+        /**
+         * Computes the force for a single pair of residues, in a fused pass.
+         * @param pair Pair of residues.
+         * @param dynamics Dynamics object to add potential energy and forces
+         * to.
+         */
+        void fusedPairPart(vl::PairInfo const& pair,
+            Dynamics& dynamics) const override;
+
     public:
         double screeningDist = 10.0 * angstrom;
         double r0 = 4.0 * angstrom;
@@ -4,8 +4,8 @@
 namespace mdk {
     /**
      * Go model potential. It is somewhat special as it interferes with
-     * the Verlet list and with the quasi-adiabatic potential. It should go
-     * first in the list of nonlocal forces added to the simulation object.
+     * the Verlet list and with the quasi-adiabatic potential: the native
+     * contacts are excluded from the other nonlocal interactions.
      */
     class NativeContacts: public NonlocalForce {
     public:
@@ -36,9 +36,10 @@ namespace mdk {
         void asyncPart(Dynamics &dynamics) override;
 
         /**
-         * Action to perform when the Verlet list is updated. We want to (a)
-         * retrieve the pairs that are in native contact into a list (\p
-         * curPairs), (b) remove those pairs from the global Verlet list.
+         * Action to perform when the Verlet list is updated. We retrieve the
+         * pairs that are in native contact into a list (\p curPairs); these
+         * pairs are excluded from the other sublists of the Verlet list by
+         * the list itself (see \p vl::List::addExclusions).
          */
         void vlUpdateHook() override;
 
@@ -49,15 +50,21 @@ namespace mdk {
          */
         vl::Spec spec() const override;
 
+        /// List of all native contacts.
+        std::vector<Contact> allContacts;
+
         /**
-         * A "copy" of the global Verlet list to be swapped with it when we
-         * update it; we want to do the swap so as to avoid excessive allocation
-         * of memory when the program runs.
+         * List of all native contacts, with the indices of the residues in
+         * the storage order of the state (see \p State::permute), sorted in
+         * that order.
          */
-        Pairs newVL;
+        std::vector<Contact> storedContacts;
 
-        /// List of all native contacts.
-        std::vector<Contact> allContacts;
+        /**
+         * Recreate \p storedContacts from \p allContacts, after the residues
+         * are reordered.
+         */
+        void updateStoredContacts();
 
         /// List of native contacts that are within the cutoff distance.
         std::vector<Contact> curPairs;
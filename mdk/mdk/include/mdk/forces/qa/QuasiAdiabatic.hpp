@@ -8,6 +8,7 @@
 #include "../../data/Chains.hpp"
 #include "../../stats/Stats.hpp"
 #include "../../data/Primitives.hpp"
+#include "../../system/ChainGeometry.hpp"
 #include <mutex>
 
 namespace mdk {
@@ -167,11 +168,46 @@ namespace mdk {
          */
         SidechainLJ ss_ljs[AminoAcid::N][AminoAcid::N];
 
-        /// An array of vectors $n_i$, as defined in CPC14.pdf.
-        Vectors n;
+        /**
+         * Kernel of a contact, covering all the types of the contacts, so
+         * that the contacts can be processed in batches (see \p PairForce):
+         * an L-J potential which is flat (as in \p SidechainLJ) below
+         * \p sinkMax, which is zero for the contacts other than the
+         * sidechain-sidechain ones.
+         */
+        struct ContactKernel {
+            LennardJones lj;
+            double sinkMax = 0.0;
+
+            /**
+             * The force is applied along the vector from the first residue
+             * to the second one, as in the reference implementation, so
+             * its sign is opposite to the one of \p LennardJones.
+             */
+            static constexpr double forceSign = -LennardJones::forceSign;
 
-        /// An array of vectors $h_i$, as defined in CPC14.pdf.
-        Vectors h;
+            /**
+             * Compute the potential energy of the contact; the L-J potential
+             * is evaluated in any case, so as not to branch.
+             * @param norm Distance between the residues.
+             * @param V Variable to add the potential to.
+             * @param dV_dn Variable to add the derivative to.
+             */
+            inline void computeV(double norm, double& V, double& dV_dn) const {
+                double V_lj = 0.0, dV_dn_lj = 0.0;
+                lj.computeV(norm, V_lj, dV_dn_lj);
+
+                bool flat = norm <= sinkMax;
+                V += flat ? -lj.depth : V_lj;
+                dV_dn += flat ? 0.0 : dV_dn_lj;
+            }
+        };
+
+        /**
+         * Geometry of the chains, in particular the vectors $n_i$ and $h_i$,
+         * as defined in CPC14.pdf.
+         */
+        ChainGeometry const* geometry = nullptr;
 
         /**
          * A maximum distance (across all types of contacts) between residues
@@ -224,6 +260,14 @@ namespace mdk {
          */
         double breakingTime = 10.0 * tau;
 
+        /**
+         * Stage of a contact, i.e. the fraction of the depth of the potential
+         * reached by a forming contact, or remaining for a breaking one.
+         * @param cont Contact.
+         * @return Stage of the contact, between 0 and 1.
+         */
+        double stage(QAContact const& cont) const;
+
         /**
          * The list of old pairs, with which the new pairs are swapped. This
          * is done in order to not have to allocate new memory each time a
@@ -264,9 +308,15 @@ namespace mdk {
         std::vector<QADiff> qaDiffs;
 
         /**
-         * Compute a list of vectors $n_i$ and $h_i$.
+         * Indices (in \p pairs) of the contacts removed in the asynchronous
+         * part, which are shared between the threads. They are turned into
+         * free pairs in the \p syncPart, in the order of \p pairs, so that
+         * the order of the free pairs doesn't depend on the threads.
          */
-        void computeNH();
+        std::vector<int> removedIdx;
+
+        /// A mutex for the access to the \p removedIdx list.
+        std::mutex removedIdxMutex;
 
         /**
          * Perform a geometry check between two residues during the
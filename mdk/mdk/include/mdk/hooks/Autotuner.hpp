@@ -0,0 +1,149 @@
+#pragma once
+#include "Hook.hpp"
+#include "../simul/SimulVar.hpp"
+#include "../system/State.hpp"
+#include "../verlet/List.hpp"
+#include "../utils/Units.hpp"
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace mdk {
+    /**
+     * A hook tuning the parameters of the simulation which affect only its
+     * performance: the padding of the Verlet list, the algorithm with which
+     * it's reconstructed and the number of (OpenMP) threads. The best values
+     * depend on the system and on the machine, so rather than guessing them,
+     * during the first steps of the simulation we try out a number of
+     * configurations, each for \p trialSteps steps, and pick the fastest
+     * one. The parameters are tuned one at a time: first the number of
+     * threads, then the algorithm, and finally the padding.
+     *
+     * For a configuration, we measure the (wall-clock) time of a step
+     * excluding the updates of the list, the time of an update and the
+     * rate at which the padding is used up, and estimate from these the
+     * average time of a step in the long run, i.e. with the updates
+     * amortized over the steps between them. This way the trials can be
+     * much shorter than the intervals between the updates.
+     *
+     * The chosen configuration can be saved into a profile file, and loaded
+     * from it in the subsequent simulations of the same system, in which
+     * case no tuning is performed.
+     */
+    class Autotuner: public Hook, SimulVar {
+    public:
+        /**
+         * Construct an \p Autotuner object.
+         * @param profilePath Path to the profile file; if it exists (and
+         * matches the system), the configuration is loaded from it instead
+         * of being tuned, otherwise the tuned configuration is saved to it.
+         * If empty, the profile is neither loaded nor saved.
+         */
+        explicit Autotuner(std::string profilePath = "");
+
+        void bind(Simulation& simulation) override;
+
+        void execute(int step_nr) override;
+
+        /**
+         * Number of steps before the first trial, so that the measurements
+         * are not affected by the initial transients (like cold caches).
+         */
+        int warmupSteps = 20;
+
+        /**
+         * Number of steps for which each configuration is tried out.
+         */
+        int trialSteps = 100;
+
+        /**
+         * Candidate paddings of the Verlet list.
+         */
+        std::vector<double> pads = {
+            4.0 * angstrom, 6.0 * angstrom, 8.0 * angstrom,
+            10.0 * angstrom, 12.0 * angstrom, 15.0 * angstrom
+        };
+
+        /**
+         * Candidate numbers of threads; if empty, the powers of two up to
+         * the number of available processors are tried out.
+         */
+        std::vector<int> threadCounts;
+
+        /**
+         * Whether to print the measurements and the choices.
+         */
+        bool verbose = true;
+
+        /**
+         * @return Whether the tuning has finished, or the configuration has
+         * been loaded from the profile.
+         */
+        bool finished() const;
+
+    private:
+        /**
+         * A configuration of the tuned parameters.
+         */
+        struct Config {
+            double pad;
+            vl::List::Algorithm algorithm;
+            int threads;
+        };
+
+        std::string profilePath;
+
+        vl::List* vl = nullptr;
+        State const* state = nullptr;
+
+        enum class Stage { WARMUP, THREADS, ALGORITHM, PAD, FINISHED };
+        Stage stage = Stage::WARMUP;
+
+        /**
+         * Configurations to try out in the current stage, and the index of
+         * the one being tried out.
+         */
+        std::vector<Config> candidates;
+        int candidateIdx = 0;
+
+        /**
+         * Best configuration so far, and its estimated time of a step.
+         */
+        Config best;
+        double bestCost = 0.0;
+
+        /**
+         * Measurements of the current trial (or the warmup): the number of
+         * steps, and the values at its start of the wall-clock time and of
+         * the counters of the Verlet list.
+         */
+        using time_point = std::chrono::steady_clock::time_point;
+        int steps = 0;
+        time_point trialStart;
+        int updates0 = 0;
+        double updateTime0 = 0.0;
+
+        void apply(Config const& config);
+        void startTrial();
+
+        /**
+         * Estimates the average time of a step for the configuration tried
+         * out in the trial which has just finished.
+         * @return Estimated time of a step, in seconds.
+         */
+        double finishTrial();
+
+        /**
+         * Prepares the candidates for the next stage (skipping the stages
+         * with fewer than two candidates), or finishes the tuning.
+         */
+        void nextStage();
+
+        void finish();
+
+        bool loadProfile();
+        void saveProfile() const;
+
+        std::string describe(Config const& config) const;
+    };
+}
@@ -38,6 +38,15 @@ namespace mdk {
          * was invoked.
          */
         void execute(int step_nr) override;
+
+        /**
+         * Output the drift report, i.e. the largest and the average diffs over
+         * the steps compared so far, to the diff file; this serves to compare
+         * the builds (for example with and without MIXED_PRECISION) against
+         * the same reference. It's to be invoked after the simulation (it
+         * does nothing if no step has been compared).
+         */
+        void reportDrift();
     private:
         /**
          * A path to the Fortran reference positions file.
@@ -55,6 +64,13 @@ namespace mdk {
          */
         std::map<int, Vectors> refPositions;
 
+        /**
+         * Largest diff, sum of the mean diffs and the number of the steps
+         * compared so far, for the drift report.
+         */
+        double driftMax = 0.0, driftMeanSum = 0.0;
+        int numCompared = 0;
+
         /**
          * Saved const pointer to the state of the simulation.
          */
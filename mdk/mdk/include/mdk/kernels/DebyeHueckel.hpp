@@ -0,0 +1,85 @@
+#pragma once
+#include "../data/Primitives.hpp"
+#include "../utils/Units.hpp"
+#include <cmath>
+
+namespace mdk {
+    /**
+     * Debye-Hueckel screened electrostatic potential, for a single pair of
+     * residues (the product of their charges is included in the
+     * \p amplitude).
+     */
+    class DebyeHueckel {
+    public:
+        double amplitude = 0.0;
+        double screeningDist = 10.0 * angstrom;
+
+        /**
+         * Exponent of the distance in the permittivity of the medium: 1 if
+         * it's proportional to the distance (as in \p RelativeDH), 0 if it's
+         * constant (as in \p ConstDH); this changes the derivative of the
+         * potential. It's a number rather than a flag, so that the loops
+         * evaluating the kernel for a batch of pairs (see \p PairForce) can
+         * be vectorized.
+         */
+        double permittivityExp = 0.0;
+
+        DebyeHueckel() = default;
+        DebyeHueckel(double amplitude, double screeningDist, bool relative):
+            amplitude(amplitude), screeningDist(screeningDist),
+            permittivityExp(relative ? 1.0 : 0.0) {};
+
+        inline double cutoff() const {
+            return screeningDist;
+        }
+
+        /**
+         * Sign of the force: the force on the first residue of a pair is
+         * forceSign * dV_dn * unit, where unit is the unit vector from the
+         * second residue to the first one (see \p computeF). Here, it's
+         * positive, i.e. the force points along the gradient of the
+         * potential rather than against it, as in the reference
+         * implementation.
+         */
+        static constexpr double forceSign = 1.0;
+
+        /**
+         * Compute the potential energy of the force field.
+         * @param norm Distance between the residues.
+         * @param V Variable to add the potential to.
+         * @param dV_dn Variable to add the derivative to.
+         */
+        inline void computeV(double norm, double& V, double& dV_dn) const {
+            Real _norm = norm, _screeningDist = screeningDist;
+            Real V_DH = Real(amplitude) * std::exp(-_norm/_screeningDist)
+                / _norm;
+            V += V_DH;
+            dV_dn += -V_DH * (Real(1.0) + Real(permittivityExp) +
+                _norm/_screeningDist) / _norm;
+        }
+
+        /**
+         * Compute and add the D-H force between two residues. The templates
+         * are here in order for us to be able to pass Eigen expressions
+         * to it.
+         * @tparam T1 Type of an lvalue to add the force on the first residue
+         * to.
+         * @tparam T2 Type of an lvalue to add the force on the second residue
+         * to.
+         * @param unit Normalized vector between the residues.
+         * @param norm Distance between the residues.
+         * @param V Variable to add the potential to.
+         * @param F1 Lvalue to add the force on the first residue to.
+         * @param F2 Lvalue to add the force on the second residue to.
+         */
+        template<typename T1, typename T2>
+        inline void computeF(VRef unit, double norm, double& V,
+            T1 F1, T2 F2) const {
+
+            double dV_dn = 0.0;
+            computeV(norm, V, dV_dn);
+            F1 += forceSign * dV_dn * unit;
+            F2 -= forceSign * dV_dn * unit;
+        }
+    };
+}
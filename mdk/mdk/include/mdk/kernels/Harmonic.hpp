@@ -34,9 +34,10 @@ namespace mdk {
          * @param dV_dx Variable to add the derivative to.
          */
         inline void computeV(double dx, double& V, double& dV_dx) const {
-            auto dx2 = dx*dx;
-            V += dx2 * (H1 + H2 * dx2);
-            dV_dx += dx * (2.0 * H1 + 4.0 * H2 * dx2);
+            Real _dx = dx, _H1 = H1, _H2 = H2;
+            Real dx2 = _dx*_dx;
+            V += dx2 * (_H1 + _H2 * dx2);
+            dV_dx += _dx * (Real(2.0) * _H1 + Real(4.0) * _H2 * dx2);
         }
 
         /**
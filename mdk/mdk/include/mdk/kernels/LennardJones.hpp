@@ -26,6 +26,13 @@ namespace mdk {
             return 2.5 * pow(2.0, -1.0/6.0) * r_min;
         }
 
+        /**
+         * Sign of the force: the force on the first residue of a pair is
+         * forceSign * dV_dn * unit, where unit is the unit vector from the
+         * second residue to the first one (see \p computeF).
+         */
+        static constexpr double forceSign = -1.0;
+
         /**
          * Compute the potential energy of the force field.
          * @param norm Distance between the residues.
@@ -33,10 +40,10 @@ namespace mdk {
          * @param dV_dn Variable to add the derivative to.
          */
         inline void computeV(double norm, double& V, double& dV_dn) const {
-            auto norm_inv = 1.0 / norm, s = norm_inv * r_min;
-            auto s6 = s*s*s*s*s*s, s12 = s6*s6;
-            V += depth * (s12 - 2.0 * s6);
-            dV_dn += 12 * depth * (s6 - s12) * norm_inv;
+            Real norm_inv = Real(1.0) / Real(norm), s = norm_inv * Real(r_min);
+            Real s6 = s*s*s*s*s*s, s12 = s6*s6;
+            V += Real(depth) * (s12 - Real(2.0) * s6);
+            dV_dn += Real(12) * Real(depth) * (s6 - s12) * norm_inv;
         }
 
         /**
@@ -59,8 +66,8 @@ namespace mdk {
 
             double dV_dn = 0.0;
             computeV(norm, V, dV_dn);
-            F1 -= dV_dn * unit;
-            F2 += dV_dn * unit;
+            F1 += forceSign * dV_dn * unit;
+            F2 -= forceSign * dV_dn * unit;
         }
     };
 }
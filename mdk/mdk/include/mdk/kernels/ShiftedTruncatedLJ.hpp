@@ -19,6 +19,13 @@ namespace mdk {
             return r_cut;
         }
 
+        /**
+         * Sign of the force: the force on the first residue of a pair is
+         * forceSign * dV_dn * unit, where unit is the unit vector from the
+         * second residue to the first one (see \p computeF).
+         */
+        static constexpr double forceSign = -1.0;
+
         /**
          * Compute the potential energy of the force field.
          * @param norm Distance between the residues.
@@ -26,10 +33,10 @@ namespace mdk {
          * @param dV_dn Variable to add the derivative to.
          */
         inline void computeV(double norm, double& V, double& dV_dn) const {
-            auto norm_inv = 1.0 / norm, s = norm_inv * r_cut;
-            auto s6 = s*s*s*s*s*s, s12 = s6*s6;
-            V += depth * (s12 - 2.0 * s6 + 1.0);
-            dV_dn +=  12 * depth * (s6 - s12) * norm_inv;
+            Real norm_inv = Real(1.0) / Real(norm), s = norm_inv * Real(r_cut);
+            Real s6 = s*s*s*s*s*s, s12 = s6*s6;
+            V += Real(depth) * (s12 - Real(2.0) * s6 + Real(1.0));
+            dV_dn += Real(12) * Real(depth) * (s6 - s12) * norm_inv;
         }
 
         /**
@@ -52,8 +59,8 @@ namespace mdk {
 
             double dV_dn = 0.0;
             computeV(norm, V, dV_dn);
-            F1 -= dV_dn * unit;
-            F2 += dV_dn * unit;
+            F1 += forceSign * dV_dn * unit;
+            F2 -= forceSign * dV_dn * unit;
         }
     };
 }
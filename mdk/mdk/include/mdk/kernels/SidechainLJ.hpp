@@ -23,6 +23,13 @@ namespace mdk {
             return LennardJones(sink_max, depth).cutoff();
         }
 
+        /**
+         * Sign of the force: the force on the first residue of a pair is
+         * forceSign * dV_dn * unit, where unit is the unit vector from the
+         * second residue to the first one (see \p computeF).
+         */
+        static constexpr double forceSign = -1.0;
+
         /**
          * Compute the potential energy of the force field.
          * @param norm Distance between the residues.
@@ -54,8 +61,8 @@ namespace mdk {
 
             double dV_dn = 0.0;
             computeV(norm, V, dV_dn);
-            F1 -= dV_dn * unit;
-            F2 += dV_dn * unit;
+            F1 += forceSign * dV_dn * unit;
+            F2 -= forceSign * dV_dn * unit;
         }
     };
 }
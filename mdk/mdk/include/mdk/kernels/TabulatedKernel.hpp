@@ -0,0 +1,217 @@
+#pragma once
+#include "../data/Primitives.hpp"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace mdk {
+    /**
+     * A tabulated version of another kernel (e.g. \p LennardJones or
+     * \p DebyeHueckel), with the same interface, so that a force can switch
+     * to it by changing the template argument of \p PairForce.
+     *
+     * The potential and its derivative wrt the distance are tabulated as
+     * functions of the squared distance on [r_min^2, cutoff^2], as piecewise
+     * cubic Hermite polynomials; the number of segments is doubled until the
+     * measured error is below the requested bound on every segment, relative
+     * to the largest magnitude of the function on that segment (so that the
+     * steep parts of the potential, e.g. the L-J wall, don't dominate the
+     * bound elsewhere). Outside of the tabulated range, the wrapped kernel is
+     * evaluated directly.
+     *
+     * The tables are held by value, so the kernel is meant to be shared by
+     * the pairs (\p PairForce refers to it rather than copying it, see
+     * \p ConstDH::tabulated for an example), rather than created for each
+     * pair.
+     * @tparam Kernel Type of the wrapped kernel.
+     */
+    template<typename Kernel>
+    class TabulatedKernel {
+    public:
+        /// The wrapped kernel.
+        Kernel kernel;
+
+        TabulatedKernel() = default;
+
+        /**
+         * Create the tables for a kernel.
+         * @param kernel Kernel to tabulate.
+         * @param r_min Lower bound of the tabulated range of distances.
+         * @param maxRelError Bound on the error of the potential and of its
+         * derivative on each segment of the tables, relative to their
+         * largest magnitudes on the segment.
+         * @param maxSegments Limit on the number of segments of the tables;
+         * if it's reached, the bound on the error may not be met (see
+         * \p maxError).
+         */
+        TabulatedKernel(Kernel const& kernel, double r_min,
+            double maxRelError = 1.0e-6, int maxSegments = 1 << 20):
+            kernel(kernel) {
+
+            sMin = r_min * r_min;
+            sMax = pow(kernel.cutoff(), 2.0);
+
+            for (int numSegments = 64; ; numSegments *= 2) {
+                tabulate(numSegments);
+                measuredError = measureError();
+                if (measuredError <= maxRelError || 2 * numSegments > maxSegments)
+                    break;
+            }
+        }
+
+        inline double cutoff() const {
+            return kernel.cutoff();
+        }
+
+        /**
+         * Sign of the force, the same as for the wrapped kernel.
+         */
+        static constexpr double forceSign = Kernel::forceSign;
+
+        /**
+         * Maximum error of the tables (for the potential and its derivative,
+         * on each segment relative to their largest magnitudes on the
+         * segment), measured at construction at points strictly between the
+         * nodes of the tables (at which the tables are exact).
+         */
+        double maxError() const {
+            return measuredError;
+        }
+
+        /// Number of the segments of the tables.
+        int numSegments() const {
+            return (int)segments.size();
+        }
+
+        /**
+         * Compute the potential energy of the force field.
+         * @param norm Distance between the residues.
+         * @param V Variable to add the potential to.
+         * @param dV_dn Variable to add the derivative to.
+         */
+        inline void computeV(double norm, double& V, double& dV_dn) const {
+            auto s = norm * norm;
+            if (s < sMin || s >= sMax) {
+                kernel.computeV(norm, V, dV_dn);
+                return;
+            }
+
+            auto x = (s - sMin) * segLenInv;
+            int k = std::min((int)x, (int)segments.size() - 1);
+            auto t = x - k;
+
+            auto const& seg = segments[k];
+            V += seg.V[0] + t * (seg.V[1] + t * (seg.V[2] + t * seg.V[3]));
+            dV_dn += seg.D[0] + t * (seg.D[1] + t * (seg.D[2] + t * seg.D[3]));
+        }
+
+        /**
+         * Compute and add the force between two residues, in the same
+         * direction as the wrapped kernel would.
+         * @tparam T1 Type of an lvalue to add the force on the first residue
+         * to.
+         * @tparam T2 Type of an lvalue to add the force on the second residue
+         * to.
+         * @param unit Normalized vector between the residues.
+         * @param norm Distance between the residues.
+         * @param V Variable to add the potential to.
+         * @param F1 Lvalue to add the force on the first residue to.
+         * @param F2 Lvalue to add the force on the second residue to.
+         */
+        template<typename T1, typename T2>
+        inline void computeF(VRef unit, double norm, double& V,
+            T1 F1, T2 F2) const {
+
+            double dV_dn = 0.0;
+            computeV(norm, V, dV_dn);
+            F1 += forceSign * dV_dn * unit;
+            F2 -= forceSign * dV_dn * unit;
+        }
+
+    private:
+        /**
+         * Coefficients of the polynomials (in the position within the
+         * segment, from 0 to 1) of the potential and of its derivative for a
+         * single segment; they're kept together (and aligned), so that an
+         * evaluation touches a single cache line.
+         */
+        struct alignas(64) Segment {
+            double V[4], D[4];
+        };
+
+        std::vector<Segment> segments;
+        double sMin = 0.0, sMax = 0.0, segLen = 0.0, segLenInv = 0.0;
+        double measuredError = 0.0;
+
+        void exact(double s, double& V, double& D) const {
+            V = D = 0.0;
+            kernel.computeV(sqrt(s), V, D);
+        }
+
+        void tabulate(int numSegments) {
+            segLen = (sMax - sMin) / numSegments;
+            segLenInv = 1.0 / segLen;
+
+            /* The values at the nodes, and the derivatives wrt the position
+             * within the segment: for the potential, it follows from the
+             * derivative wrt the distance, and for the derivative itself
+             * it's computed with a central difference.
+             */
+            std::vector<double> V(numSegments + 1), D(numSegments + 1),
+                mV(numSegments + 1), mD(numSegments + 1);
+            auto delta = 1.0e-3 * segLen;
+            for (int k = 0; k <= numSegments; ++k) {
+                auto s = sMin + k * segLen;
+                exact(s, V[k], D[k]);
+                mV[k] = segLen * D[k] / (2.0 * sqrt(s));
+
+                double V_lo, D_lo, V_hi, D_hi;
+                exact(s - delta, V_lo, D_lo);
+                exact(s + delta, V_hi, D_hi);
+                mD[k] = segLen * (D_hi - D_lo) / (2.0 * delta);
+            }
+
+            segments.resize(numSegments);
+            for (int k = 0; k < numSegments; ++k) {
+                hermite(V[k], V[k+1], mV[k], mV[k+1], segments[k].V);
+                hermite(D[k], D[k+1], mD[k], mD[k+1], segments[k].D);
+            }
+        }
+
+        static void hermite(double y0, double y1, double m0, double m1,
+            double *coeffs) {
+
+            coeffs[0] = y0;
+            coeffs[1] = m0;
+            coeffs[2] = 3.0 * (y1 - y0) - 2.0 * m0 - m1;
+            coeffs[3] = 2.0 * (y0 - y1) + m0 + m1;
+        }
+
+        double measureError() const {
+            double maxErr = 0.0;
+            for (int k = 0; k < (int)segments.size(); ++k) {
+                /* The magnitudes on the segment include the nodes, where
+                 * the error is not sampled. */
+                double maxV = 0.0, maxD = 0.0, errV = 0.0, errD = 0.0;
+                for (auto t: { 0.0, 0.125, 0.375, 0.625, 0.875, 1.0 }) {
+                    auto s = sMin + (k + t) * segLen;
+                    double V, D;
+                    exact(s, V, D);
+                    maxV = std::max(maxV, std::abs(V));
+                    maxD = std::max(maxD, std::abs(D));
+                    if (t == 0.0 || t == 1.0) continue;
+
+                    double V_tab = 0.0, D_tab = 0.0;
+                    computeV(sqrt(s), V_tab, D_tab);
+                    errV = std::max(errV, std::abs(V_tab - V));
+                    errD = std::max(errD, std::abs(D_tab - D));
+                }
+
+                maxErr = std::max(maxErr, std::max(
+                    maxV > 0.0 ? errV / maxV : errV,
+                    maxD > 0.0 ? errD / maxD : errD));
+            }
+            return maxErr;
+        }
+    };
+}
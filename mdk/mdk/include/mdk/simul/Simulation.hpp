@@ -16,6 +16,7 @@ namespace mdk {
     class NonlocalForce;
     class Hook;
     class Integrator;
+    class ChainGeometry;
 
     /**
      * The main class of the library, responsible for:
@@ -85,6 +86,17 @@ namespace mdk {
             }
         }
 
+        /**
+         * Checks whether a variable of a given type has been added to the
+         * simulation (unlike \p var, it never emplaces it).
+         * @tparam Var Type of the variable to check.
+         * @return Whether the variable is present.
+         */
+        template<typename Var>
+        bool has() const {
+            return vars.find(std::type_index(typeid(Var))) != vars.end();
+        }
+
         /**
          * Add a variable to the simulation. Depending on the type of the
          * variable, additional actions may be performed (such as binding to the
@@ -136,6 +148,11 @@ namespace mdk {
                 integrator = &(Integrator&)x;
             }
 
+            if constexpr (std::is_base_of_v<ChainGeometry, T>) {
+                // If a \p ChainGeometry, update it at every step
+                geometry = &(ChainGeometry&)x;
+            }
+
             // Return the reference
             return x;
         }
@@ -170,6 +187,52 @@ namespace mdk {
          */
         void step(double t);
 
+        virtual ~Simulation() = default;
+
+    protected:
+        /// Force fields of the simulation
+        std::vector<Force*> forces;
+
+        /// Hooks of the simulation
+        std::vector<Hook*> hooks;
+
+        /// Pointer to the integrator used in the simulation.
+        Integrator *integrator = nullptr;
+
+        /**
+         * Invoked at the initialization, before the forces are first
+         * computed; the derived classes may take over (some of) the forces,
+         * the integrator and the hooks here, see \p StaticSimulation.
+         */
+        virtual void compose();
+
+        /**
+         * Invokes the asynchronous parts of the forces. It's executed by all
+         * the threads of the parallel region in \p calcForces.
+         * @param dynamics Dynamics object (of the thread) to add potential
+         * energy and forces to.
+         */
+        virtual void asyncForces(Dynamics& dynamics);
+
+        /**
+         * Invokes the synchronous parts of the forces, in the order of their
+         * addition.
+         * @param dynamics Dynamics object to add potential energy and forces
+         * to.
+         */
+        virtual void syncForces(Dynamics& dynamics);
+
+        /**
+         * Invokes the integrator, after the forces have been computed.
+         */
+        virtual void integrate();
+
+        /**
+         * Executes the hooks, in the order of their addition.
+         * @param step_nr Number of the step of the simulation.
+         */
+        virtual void runHooks(int step_nr);
+
     private:
         /// Model of the simulation.
         Model model;
@@ -186,9 +249,6 @@ namespace mdk {
          */
         std::unordered_map<std::type_index, std::shared_ptr<void>> vars;
 
-        /// Force fields of the simulation
-        std::vector<Force*> forces;
-
         /**
          * List of nonlocal forces of the simulation - the distinction is used
          * when the Verlet list is updated, so as to invoke appropriate update
@@ -196,18 +256,15 @@ namespace mdk {
          */
         std::vector<NonlocalForce*> nonlocalForces;
 
-        /// Hooks of the simulation
-        std::vector<Hook*> hooks;
-
         /// Async tasks.
         std::vector<std::function<void()>> asyncTasks;
 
-        /// Pointer to the integrator used in the simulation.
-        Integrator *integrator = nullptr;
-
         State *state = nullptr;
         vl::List *verlet_list = nullptr;
 
+        /// Cache of the geometry of the chains, if any force uses it.
+        ChainGeometry *geometry = nullptr;
+
         /**
          * Whether simulation has yet been initialized; used for running the
          * init function only once.
@@ -0,0 +1,148 @@
+#pragma once
+#include "Simulation.hpp"
+#include "../forces/Force.hpp"
+#include "../hooks/Hook.hpp"
+#include "../system/Integrator.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <tuple>
+
+namespace mdk {
+    /**
+     * A variant of \p Simulation with (some of) the per-step pipeline
+     * composed at compile time. The listed objects (forces, the integrator
+     * and hooks) are added to the simulation as usual; at the
+     * initialization, they are taken out of the (dynamic) lists of the
+     * simulation, and from then on they are invoked directly, i.e. without
+     * the virtual dispatch, so that the compiler may inline them (with
+     * link-time optimization, if they are defined in the library) and
+     * optimize the per-step pipeline as a whole. Most of the forces are
+     * defined in the library, so they are inlined only if it's built with
+     * link-time optimization (the \p LTO option); otherwise the calls are
+     * merely direct rather than virtual.
+     *
+     * The remaining forces and hooks are invoked as in \p Simulation, after
+     * the listed ones; in particular, the synchronous parts of the listed
+     * forces are executed first, and the listed hooks are executed before
+     * the others, in the order of the list. The initialization of the
+     * integrator (\p Integrator::init) is invoked virtually, as it's done
+     * only once.
+     * @tparam Vars Types of the objects to compose: forces, hooks and at
+     * most one integrator; each one must have been added to the simulation
+     * by the initialization (otherwise it throws), and the integrator must
+     * be the one used by the simulation.
+     */
+    template<typename... Vars>
+    class StaticSimulation: public Simulation {
+        static_assert(((std::is_base_of_v<Force, Vars> ||
+            std::is_base_of_v<Hook, Vars> ||
+            std::is_base_of_v<Integrator, Vars>) && ...),
+            "StaticSimulation can only compose forces, hooks and integrators");
+
+        static_assert((std::is_base_of_v<Integrator, Vars> + ... + 0) <= 1,
+            "StaticSimulation can compose at most one integrator");
+
+    public:
+        /**
+         * Initialize simulation from a \p Model object and the parameters.
+         * @param model Model of the simulation.
+         * @param params Parameters of the simulation.
+         */
+        StaticSimulation(Model model, param::Parameters params):
+            Simulation(std::move(model), std::move(params)) {};
+
+    protected:
+        void compose() override {
+            if (!(has<Vars>() && ...)) {
+                throw std::runtime_error("A composed object has not been "
+                    "added to the simulation");
+            }
+            statics = std::make_tuple(&var<Vars>()...);
+
+            if (hasStaticIntegrator && !composes(integrator)) {
+                throw std::runtime_error("The composed integrator is not "
+                    "the one used by the simulation");
+            }
+
+            forces.erase(std::remove_if(forces.begin(), forces.end(),
+                [&](Force* force) -> bool { return composes(force); }),
+                forces.end());
+            hooks.erase(std::remove_if(hooks.begin(), hooks.end(),
+                [&](Hook* hook) -> bool { return composes(hook); }),
+                hooks.end());
+        }
+
+        void asyncForces(Dynamics& dyn) override {
+            (asyncPart<Vars>(dyn), ...);
+            Simulation::asyncForces(dyn);
+        }
+
+        void syncForces(Dynamics& dyn) override {
+            (syncPart<Vars>(dyn), ...);
+            Simulation::syncForces(dyn);
+        }
+
+        void integrate() override {
+            if constexpr (hasStaticIntegrator) {
+                (integrate<Vars>(), ...);
+            }
+            else {
+                Simulation::integrate();
+            }
+        }
+
+        void runHooks(int step_nr) override {
+            (execute<Vars>(step_nr), ...);
+            Simulation::runHooks(step_nr);
+        }
+
+    private:
+        /**
+         * Pointers to the composed objects.
+         */
+        std::tuple<Vars*...> statics;
+
+        static constexpr bool hasStaticIntegrator =
+            (std::is_base_of_v<Integrator, Vars> || ...);
+
+        /**
+         * Whether an object of the dynamic lists of the simulation is one
+         * of the composed ones.
+         * @tparam Base Type of the objects of the list.
+         * @param x Object to check.
+         */
+        template<typename Base>
+        bool composes(Base const* x) const {
+            return ([&]() -> bool {
+                if constexpr (std::is_base_of_v<Base, Vars>)
+                    return x == std::get<Vars*>(statics);
+                else
+                    return false;
+            }() || ...);
+        }
+
+        template<typename Var>
+        void asyncPart(Dynamics& dyn) {
+            if constexpr (std::is_base_of_v<Force, Var>)
+                std::get<Var*>(statics)->Var::asyncPart(dyn);
+        }
+
+        template<typename Var>
+        void syncPart(Dynamics& dyn) {
+            if constexpr (std::is_base_of_v<Force, Var>)
+                std::get<Var*>(statics)->Var::syncPart(dyn);
+        }
+
+        template<typename Var>
+        void integrate() {
+            if constexpr (std::is_base_of_v<Integrator, Var>)
+                std::get<Var*>(statics)->Var::integrate();
+        }
+
+        template<typename Var>
+        void execute(int step_nr) {
+            if constexpr (std::is_base_of_v<Hook, Var>)
+                std::get<Var*>(statics)->Var::execute(step_nr);
+        }
+    };
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include "../simul/SimulVar.hpp"
+#include "../data/Primitives.hpp"
+#include "State.hpp"
+
+namespace mdk {
+    /**
+     * A cache of the geometry of the chains, i.e. of the bond vectors and of
+     * the quantities derived from them, shared by the bonded and directional
+     * forces (bond angles, dihedrals, chirality, the quasi-adiabatic
+     * potential etc.), which would otherwise compute them anew, each on its
+     * own. It's filled once per step, at the beginning of the computation of
+     * the forces (i.e. after the integration), by all the threads, and only
+     * if some force has requested it (by accessing it with
+     * \p Simulation::var).
+     */
+    class ChainGeometry: public SimulVar {
+    public:
+        /**
+         * Bond vectors: bond[i] = r_{i+1} - r_i (the vectors not between the
+         * residues of one chain are meaningless).
+         */
+        Vectors bond;
+
+        /**
+         * Norms of the bond vectors.
+         */
+        Scalars bondNorm;
+
+        /**
+         * Cross products of the consecutive bond vectors:
+         * bondCross[i] = bond[i-1] x bond[i], for the triples (i-1, i, i+1)
+         * entirely in one chain.
+         */
+        Vectors bondCross;
+
+        /// An array of vectors $n_i$, as defined in CPC14.pdf.
+        Vectors n;
+
+        /// An array of vectors $h_i$, as defined in CPC14.pdf.
+        Vectors h;
+
+        /**
+         * Bind the cache to the simulation.
+         * @param simulation Simulation to bind to.
+         */
+        void bind(Simulation& simulation) override;
+
+        /**
+         * Update the cache from the current positions. It must be executed
+         * by all the threads of a parallel region; it ends with a barrier,
+         * so that the forces may use the cache right away.
+         */
+        void update();
+
+    private:
+        State const* state = nullptr;
+
+        /**
+         * triples[i] = 1 if the triple (i-1, i, i+1) is entirely in one
+         * chain (see \p Chains::triples).
+         */
+        Bytes triples;
+    };
+}
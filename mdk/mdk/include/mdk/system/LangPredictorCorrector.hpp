@@ -24,6 +24,12 @@ namespace mdk {
          */
         double gamma = 2.0 * f77mass / tau;
 
+        /**
+         * Temperature of the heat bath; at zero, the noise vanishes and the
+         * dynamics is deterministic.
+         */
+        double temperature = 0.35 * eps_kB;
+
     private:
         double dt;
         Masses m;
@@ -36,7 +42,5 @@ namespace mdk {
         void generateNoise();
 
         bool initialized = false;
-
-        double temperature = 0.35 * eps_kB;
     };
 }
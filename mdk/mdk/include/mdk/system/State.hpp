@@ -3,6 +3,7 @@
 #include "../utils/Topology.hpp"
 #include "../model/Model.hpp"
 #include "../simul/SimulVar.hpp"
+#include <functional>
 
 namespace mdk {
     /**
@@ -32,6 +33,62 @@ namespace mdk {
 
         Dynamics dyn;
 
+#ifdef MIXED_PRECISION
+        /**
+         * Single-precision copy of the positions, from which the pairwise
+         * forces (see \p PairForce) gather the positions. It's stored by
+         * rows, i.e. as three contiguous arrays of the x, y and z
+         * coordinates, and it's refreshed in \p prepareDyn (and in
+         * \p permute) only if some force has requested it with
+         * \p useShadow.
+         */
+        Eigen::Matrix<Real, 3, Eigen::Dynamic, Eigen::RowMajor> rShadow;
+
+        /// Whether \p rShadow is used, see \p useShadow.
+        bool shadowUsed = false;
+#endif
+
+        /**
+         * Requests the single-precision copy of the positions (\p rShadow)
+         * to be kept up to date; to be invoked at the binding by the forces
+         * computed with \p PairForce. Without MIXED_PRECISION, it does
+         * nothing.
+         */
+        void useShadow();
+
+        /**
+         * The residues may be stored in an order other than the original
+         * (chain) one, for example in a spatial order (see
+         * \p vl::List::spatialOrder), so that the residues close in space are
+         * close in memory. The arrays \p r, \p v and \p dyn.F, and the
+         * per-residue arrays registered in \p permuteHooks, are indexed by
+         * the storage index; \p sortedIdx[i] is the storage index of the
+         * residue i (in the original order), and \p origIdx[k] is the
+         * residue at the storage index k. The chain-based forces (bonded
+         * ones, pseudo-improper dihedral, quasi-adiabatic) and the hooks
+         * work with the original indices and go through these maps; the
+         * pairwise forces work with the storage indices.
+         */
+        Integers sortedIdx, origIdx;
+
+        /// Whether the storage order differs from the original one.
+        bool permuted = false;
+
+        /**
+         * Actions invoked after the storage order has changed (see
+         * \p permute), reordering the per-residue arrays held outside of the
+         * state (integrator derivatives, charges etc.); the argument is the
+         * \p order passed to \p permute.
+         */
+        std::vector<std::function<void(Integers const&)>> permuteHooks;
+
+        /**
+         * Changes the storage order of the residues.
+         * @param order New order, i.e. order[k] is the current storage index
+         * of the residue to be placed at the storage index k.
+         */
+        void permute(Integers const& order);
+
         void prepareDyn();
         void updateWithDyn(Dynamics const& othDyn);
         void bind(Simulation& simul) override;
@@ -43,4 +100,20 @@ namespace mdk {
          */
         void exportTo(Model& model) const;
     };
+
+    /**
+     * Reorders a per-residue array, as in \p State::permute.
+     * @tparam Array Type of the array (\p Vectors, \p Scalars,
+     * \p std::vector etc.).
+     * @param arr Array to reorder.
+     * @param order New order, i.e. order[k] is the current index of the
+     * element to be placed at the index k.
+     */
+    template<typename Array>
+    void reorder(Array& arr, Integers const& order) {
+        Array old = arr;
+        for (int k = 0; k < (int)order.size(); ++k) {
+            arr[k] = old[order[k]];
+        }
+    }
 }
@@ -0,0 +1,342 @@
+#pragma once
+#include "../data/Primitives.hpp"
+#include "../utils/Topology.hpp"
+#include <Eigen/Geometry>
+
+namespace mdk::vl {
+    /**
+     * A grid of cells, into which the residues are placed so that the pairs
+     * of residues within some distance of each other can be found by going
+     * through the pairs of neighbouring cells. The cells are no smaller than
+     * the distance in question. Along the periodic axes the grid spans the
+     * simulation box, so that the cells at the opposite sides are neighbours;
+     * along the other axes it spans the bounding box of the residues.
+     *
+     * If the dense grid would be mostly empty, as is the case for dilute
+     * systems with dense aggregates, the grid is sparse, i.e. only the
+     * occupied cells are stored, so that the cost stays near-linear
+     * regardless of how much the density varies.
+     */
+    class CellGrid {
+    public:
+        /**
+         * Dimensions of the grid.
+         */
+        Eigen::Vector3i grid;
+
+        /**
+         * Position of the "lower" corner of the grid. Along the periodic axes
+         * it is the corner of the simulation box (positions being wrapped
+         * into [-cell/2, cell/2]), along the other ones it is the corner of
+         * the bounding box of the residues.
+         */
+        Eigen::Vector3d origin;
+
+        /**
+         * Dimensions of a single cell of the grid.
+         */
+        Eigen::Vector3d cellSize;
+
+        /**
+         * Whether the grid is sparse, i.e. only the occupied cells are
+         * stored (and indexed in the order of their keys), or dense, i.e.
+         * all the cells of the grid are stored, in which case the index of
+         * a cell is its flattened location.
+         */
+        bool sparse = false;
+
+        /**
+         * Number of the (stored) cells.
+         */
+        int numCells = 0;
+
+        /**
+         * Maximal number of the cells of the dense grid, per residue; above
+         * it, the grid is sparse.
+         */
+        double maxCellsPerResidue = 2.0;
+
+        /**
+         * Index of the cell to which a given residue belongs.
+         */
+        Integers cellOf;
+
+        /**
+         * Offsets of the cells in \p cellIdx and \p cellR: the residues in the
+         * cell c occupy the range [cellStart[c], cellStart[c+1]). The size of
+         * the list is equal to the number of cells plus one.
+         */
+        Integers cellStart;
+
+        /**
+         * Indices of the residues, ordered by the cell (and, within a cell,
+         * by the index).
+         */
+        Integers cellIdx;
+
+        /**
+         * Positions of the residues, in the same order as in \p cellIdx. The
+         * copy allows us to go through the pairs of cells while accessing the
+         * memory sequentially.
+         */
+        Vectors cellR;
+
+        /**
+         * Computes the grid with cells no smaller than a given size for given
+         * positions, and places the residues into the cells. Must be executed
+         * by all the threads of a parallel region.
+         * @param r Positions of the residues.
+         * @param top Topology (box) of the system.
+         * @param minCellSize Minimal size of the cells.
+         */
+        void build(Vectors const& r, Topology const& top, double minCellSize);
+
+        /**
+         * Places the residues which have moved into the appropriate cells,
+         * keeping the grid. Must be executed by all the threads of a parallel
+         * region.
+         * @param r Positions of the residues.
+         * @param top Topology (box) of the system; it must not differ from
+         * the one with which the grid was built.
+         * @param isMoved Indicators of the moved residues.
+         * @param moved List of the moved residues.
+         */
+        void rebin(Vectors const& r, Topology const& top,
+            Bytes const& isMoved, Integers const& moved);
+
+        /**
+         * Goes through the cells which, along with a given one, form the
+         * pairs of neighbouring cells "owned" by it; by doing this for every
+         * cell, each pair of neighbouring cells (including the pairs
+         * consisting of a cell and itself) is visited exactly once.
+         * @param c1 Index of the cell.
+         * @param f Function invoked with the index of every such cell.
+         */
+        template<typename F>
+        void forEachHalfShell(int c1, F const& f) const {
+            auto loc1 = locOf(c1);
+
+            for (auto const& entry: stencil) {
+                Eigen::Vector3i loc2 = loc1 + entry.offset;
+
+                /* Along the periodic axes the offsets are nonnegative and
+                 * smaller than the size of the grid, so a single subtraction
+                 * suffices to wrap the index; along the other ones, the cells
+                 * outside of the grid are simply skipped.
+                 */
+                bool inGrid = true;
+                for (int dim = 0; dim < 3; ++dim) {
+                    if (top->use[dim]) {
+                        if (loc2[dim] >= grid[dim])
+                            loc2[dim] -= grid[dim];
+                    }
+                    else if (loc2[dim] < 0 || loc2[dim] >= grid[dim]) {
+                        inGrid = false;
+                    }
+                }
+                if (!inGrid) continue;
+
+                /* With the sparse grid, the empty cells are not stored at
+                 * all.
+                 */
+                auto c2 = cellAt(loc2);
+                if (c2 < 0) continue;
+
+                if (c2 == c1 || !entry.selfInverse || c1 < c2) f(c2);
+            }
+        }
+
+        /**
+         * Computes the (distinct) cells neighbouring a given one, including
+         * itself.
+         * @param c1 Index of the cell.
+         * @param neighbours Array of size at least 27 to write the indices
+         * of the neighbouring cells to.
+         * @return Number of the neighbouring cells.
+         */
+        int neighbourCells(int c1, int* neighbours) const;
+
+    private:
+        /**
+         * Topology and positions with which the grid was built.
+         */
+        Topology const* top = nullptr;
+        Vectors const* r = nullptr;
+        int n = 0;
+
+        /**
+         * Maximal size of the grid along an axis.
+         */
+        static constexpr int maxGridSize = 1 << 20;
+
+        /**
+         * Bounding box of the (PBC-wrapped) positions.
+         */
+        Eigen::AlignedBox3d bbox;
+
+        /**
+         * Keys (see \p keyOf) of the occupied cells, in increasing order, if
+         * the grid is sparse; the index of a cell in the sparse grid is its
+         * position in this list.
+         */
+        std::vector<long long> cellKeys;
+
+        /**
+         * Locations of the occupied cells, if the grid is sparse.
+         */
+        std::vector<Eigen::Vector3i> cellLocs;
+
+        /**
+         * Keys of the cells of the residues, if the grid is sparse.
+         */
+        std::vector<long long> residueKeys;
+
+        /**
+         * Hash table of the occupied cells, if the grid is sparse: a slot
+         * contains the index of a cell, or -1 if it's empty. The number of
+         * the slots is a power of two, and \p slotMask is one less.
+         */
+        Integers slotCells;
+        int slotMask = 0;
+
+        /**
+         * Computes the (initial) slot of a key in the hash table.
+         * @param key Key of the cell.
+         * @return Index of the slot.
+         */
+        int slotOf(long long key) const {
+            /* A multiplicative (Fibonacci) hash; the keys of the neighbouring
+             * cells are close, so we need the high bits of the product to be
+             * well mixed.
+             */
+            auto h = (unsigned long long)key * 0x9E3779B97F4A7C15ull;
+            return (int)(h >> 32) & slotMask;
+        }
+
+        /**
+         * Per-thread histograms of the cell occupancy, used for (parallel)
+         * binning of the residues into the cells.
+         */
+        std::vector<Integers> cellCounts;
+
+        /**
+         * An offset from a cell to one of its neighbours.
+         */
+        struct StencilEntry {
+            /**
+             * The offset, in canonical form (see \p setupStencil).
+             */
+            Eigen::Vector3i offset;
+
+            /**
+             * Whether the offset is its own opposite, in which case a pair
+             * of cells shall only be visited from the one with the lower
+             * index.
+             */
+            bool selfInverse;
+        };
+
+        /**
+         * A "half-shell" stencil, i.e. a list of offsets to the neighbouring
+         * cells such that, by going through the offsets for every cell, each
+         * pair of neighbouring cells (including the pairs consisting of a cell
+         * and itself) is visited exactly once, regardless of the size of the
+         * grid.
+         */
+        std::vector<StencilEntry> stencil;
+
+        /**
+         * Computes the flattened index of a cell in the grid.
+         * @param loc Unflattened index.
+         * @return Flattened index.
+         */
+        int indexOf(Eigen::Vector3i const& loc) const {
+            return loc.x() + grid.x() * (loc.y() + grid.y() * loc.z());
+        }
+
+        /**
+         * Computes the key of a cell, i.e. its flattened index as a 64-bit
+         * integer, so that it doesn't overflow for large sparse grids.
+         * @param loc Unflattened index.
+         * @return Key of the cell.
+         */
+        long long keyOf(Eigen::Vector3i const& loc) const {
+            return loc.x() + (long long)grid.x() *
+                (loc.y() + (long long)grid.y() * loc.z());
+        }
+
+        /**
+         * Finds an occupied cell with a given key in the sparse grid.
+         * @param key Key of the cell.
+         * @return Index of the cell, or -1 if it's not occupied.
+         */
+        int cellOfKey(long long key) const {
+            for (int slot = slotOf(key);; slot = (slot + 1) & slotMask) {
+                auto c = slotCells[slot];
+                if (c < 0 || cellKeys[c] == key) return c;
+            }
+        }
+
+        /**
+         * Finds the cell at a given location.
+         * @param loc Unflattened index.
+         * @return Index of the cell, or -1 if it's not stored.
+         */
+        int cellAt(Eigen::Vector3i const& loc) const {
+            return sparse ? cellOfKey(keyOf(loc)) : indexOf(loc);
+        }
+
+        /**
+         * Computes the location of a cell.
+         * @param c Index of the cell.
+         * @return Unflattened index.
+         */
+        Eigen::Vector3i locOf(int c) const {
+            if (sparse) return cellLocs[c];
+
+            return {
+                c % grid.x(),
+                (c / grid.x()) % grid.y(),
+                (c / grid.x()) / grid.y()
+            };
+        }
+
+        /**
+         * Computes the grid (its origin, dimensions and cell sizes) for the
+         * bounding box \p bbox.
+         * @param minCellSize Minimal size of the cells.
+         */
+        void setup(double minCellSize);
+
+        /**
+         * Computes \p stencil for the current grid.
+         */
+        void setupStencil();
+
+        /**
+         * Computes the cell in which a residue at a given position belongs.
+         * @param pos Position of the residue.
+         * @return Unflattened index of the cell.
+         */
+        Eigen::Vector3i locate(Vector const& pos) const;
+
+        /**
+         * Computes the keys of the cells of the residues and the (sorted)
+         * list of the occupied cells, for the sparse grid. Must be executed
+         * by all the threads of a parallel region.
+         * @param isMoved If not null, indicators of the moved residues, in
+         * which case only their keys are computed.
+         * @param moved List of the moved residues, if \p isMoved is given.
+         */
+        void findOccupiedCells(Bytes const* isMoved, Integers const* moved);
+
+        /**
+         * Places the residues into the cells (with a counting sort) and
+         * fills \p cellStart, \p cellIdx and \p cellR. Must be executed by
+         * all the threads of a parallel region.
+         * @param isMoved If not null, indicators of the moved residues, in
+         * which case only their cells are computed.
+         */
+        void binResidues(Bytes const* isMoved);
+    };
+}
@@ -4,6 +4,9 @@
 #include "../simul/SimulVar.hpp"
 #include "../data/Chains.hpp"
 #include "Spec.hpp"
+#include "NeighbourList.hpp"
+#include "CellGrid.hpp"
+#include <future>
 
 namespace mdk {
     class NonlocalForce;
@@ -42,7 +45,7 @@ namespace mdk::vl {
      */
     class List: public SimulVar {
     private:
-        State const *state = nullptr;
+        State *state = nullptr;
         Chains const* chains = nullptr;
 
         /**
@@ -69,18 +72,22 @@ namespace mdk::vl {
 
         bool initial = false;
 
+        /**
+         * Whether the list shall be reconstructed at the next check
+         * regardless of the displacement (see \p invalidate).
+         */
+        bool invalidated = false;
+
         /**
          * A maximal cutoff among registered nonlocal forces.
          */
         double cutoff = 0.0 * angstrom;
 
         /**
-         * An extra "buffer". The list by default contains elements that may be
-         * outside the maximal cutoff, which allows us to not have to
-         * reconstruct the verlet list at every time step, at the cost of
-         * spurious distance comparisons.
+         * The padding with which the current list was built; it's larger than
+         * \p pad if the list was built in the background.
          */
-        double pad = 10.0 * angstrom;
+        double listPad = 10.0 * angstrom;
 
         /**
          * Minimal bond-distance between the residues among registered nonlocal
@@ -88,54 +95,169 @@ namespace mdk::vl {
          */
         int minBondSep = 0;
 
+        /**
+         * Distinct specs of the registered nonlocal forces; the forces with
+         * equal specs share a sublist.
+         */
+        std::vector<Spec> specs;
+
+        /**
+         * Number of the registered forces using each of \p specs; the
+         * sublists of the specs no longer in use (see \p unregisterNF) are
+         * left empty.
+         */
+        Integers specUsers;
+
+        /**
+         * Excluded pairs (see \p addExclusions), sorted, and the offsets of
+         * the pairs with a given first residue, so that a lookup only
+         * searches the (few) exclusions of a single residue.
+         */
+        Pairs exclusions;
+        Integers exclusionStart;
+
+        /**
+         * The state of a reconstruction (or an incremental update) of the
+         * list: its inputs and parameters, fixed when it's started, and the
+         * grid of cells and the scratch arrays written while it runs. The
+         * list built in the background has its own, so that it shares no
+         * written state with the synchronous updates.
+         */
+        struct Build {
+            /// Positions, box and output (sublists) of the build.
+            Vectors const* r = nullptr;
+            Topology const* top = nullptr;
+            std::vector<NeighbourList>* out = nullptr;
+
+            /// Number of (OpenMP) threads to use.
+            int numThreads = 1;
+
+            /// Padding of the list, and whether to use the cell version.
+            double pad = 0.0;
+            bool useGrid = false;
+
+            /**
+             * Cutoff distance extended by the padding (and its square), and
+             * the squares of the cutoff distances of \p specs extended by
+             * the padding.
+             */
+            double effCutoff = 0.0, effCutoffSq = 0.0;
+            std::vector<double> specEffCutoffSq;
+
+            /**
+             * Grid of cells used in the cell version of the computation, and
+             * whether the list was built with it, so that the cells may be
+             * used for patching the list.
+             */
+            CellGrid cells;
+            bool haveGrid = false;
+
+            /**
+             * Per-thread counts of the pairs in each bucket (column or row),
+             * turned into the positions at which the thread places its next
+             * pair, and the first residues of the pairs ordered by the
+             * second one (with the offsets of the columns); used while
+             * gathering the pairs into the sublists.
+             */
+            std::vector<Integers> threadCounts;
+            Integers colStart, colIs;
+        };
+
+        /**
+         * The build from which the current list comes (used for patching it)
+         * and the one running in the background, if any; they are swapped
+         * when the list built in the background is swapped in.
+         */
+        Build currentBuild, backgroundBuild;
+
+        /**
+         * Adds a pair (with i1 < i2), which is at a given distance, to the
+         * sublists of the specs it satisfies.
+         * @param b Build in progress.
+         * @param pt1 Index of the first residue.
+         * @param pt2 Index of the second residue.
+         * @param r12_norm2 Square of the distance between the residues.
+         */
+        void addPair(Build& b, int pt1, int pt2, double r12_norm2);
+
+        /**
+         * Turns \p Build::threadCounts into the positions of the pairs of each
+         * thread in each bucket, with the buckets in order and, within a
+         * bucket, the threads in order. Must be executed by all the threads
+         * of a parallel region.
+         * @param b Build in progress.
+         * @param starts Output offsets of the buckets (one more than the
+         * number of buckets).
+         */
+        void scanThreadCounts(Build& b, Integers& starts);
+
+        void clearSublistsTP();
+
+        /**
+         * Gathers the thread-private lists of pairs into \p sublists. Must
+         * be executed by all the threads of a parallel region.
+         * @param b Build in progress.
+         * @param kept If not null, the lists whose pairs not involving the
+         * moved residues are to be retained.
+         */
+        void gatherSublistsTP(Build& b,
+            std::vector<NeighbourList> const* kept);
+
+        /**
+         * Computes the (maximal) displacement of the residues with respect to
+         * the reference positions, including the contribution of the change
+         * of the box.
+         * @param ref Reference positions.
+         * @param refTop Reference topology (box).
+         * @return Displacement.
+         */
+        double displacement(Vectors const& ref, Topology const& refTop) const;
+
         bool needToReset() const;
 
         /**
          * Updates the Verlet list in the "legacy fashion", i.e. going through
          * a list of pairs and checking the distances.
          */
-        void update();
+        void update(Build& b);
 
         /**
-         * Dimensions of the grid of cells used in the cell version of the
-         * computation.
+         * Indicators and the list of the residues which have moved enough to
+         * need new reference positions, for the incremental update.
          */
-        Eigen::Vector3i grid;
+        Bytes isMoved;
+        Integers moved;
 
         /**
-         * A list of size equal to the number of cells in the grid, where a
-         * nonnegative number indicates an index of the residue which is first
-         * in the linked list of residues in a given cell. If the cell is empty,
-         * the value is -1.
+         * The sublists prior to the incremental update.
          */
-        std::vector<int> first;
+        std::vector<NeighbourList> keptSublists;
 
         /**
-         * A list of size equal to the number of cells in the grid, where a
-         * nonnegative number indicates an index of the residue which is last
-         * in the linked list of residues in a given cell. If the cell is empty,
-         * the value is -1.
+         * Adds to the thread-private lists the pairs involving a moved
+         * residue.
+         * @param b Build in progress.
+         * @param pt1 Index of the moved residue.
          */
-        std::vector<int> last;
+        void perMoved(Build& b, int pt1);
 
         /**
-         * A list of size equal to the number of residues, where a nonnegative
-         * number indicates an index of a residue which is next in the linked
-         * list associated with the cell in which the residue is placed.
+         * Updates the list incrementally, i.e. gives new reference positions
+         * to the moved residues, places them into the appropriate cells,
+         * removes the pairs involving them and adds the new ones.
          */
-        std::vector<int> next;
-
-        double effCutoff, effCutoffSq;
+        void patch();
 
         /**
-         * Computes the flattened index of a cell in the grid.
-         * @param loc Unflattened index.
-         * @return Flattened index.
+         * Tries to update the list incrementally.
+         * @return Whether the update has been performed; if not, the list
+         * needs to be reconstructed.
          */
-        int indexOf(Eigen::Vector3i const& loc);
+        bool tryPatch();
 
-        void perPair(int c1, int c2);
-        void perCell(int c1);
+        void perPair(Build& b, int c1, int c2);
+        void perSelf(Build& b, int c);
+        void perCell(Build& b, int c1);
 
         /**
          * Updates the Verlet list, but instead of going through each pair we
@@ -143,11 +265,269 @@ namespace mdk::vl {
          * and then only take the pairs from the neighboring cells, which
          * reduces the computational cost from O(N^2) to O(N) (although the
          * constant behind O(N) may be significant). In practice this version
-         * is much faster, especially for large numbers of residues.
+         * is much faster, especially for large numbers of residues. The
+         * cells are never enlarged to limit their number; if the grid would
+         * be mostly empty, which is the case for dilute systems with dense
+         * aggregates, only the occupied cells are stored, so that the cost
+         * stays near-linear regardless of how much the density varies.
+         */
+        void updateGrid(Build& b);
+
+        /**
+         * Reconstructs the list (synchronously) from the current state and
+         * invokes the update hooks of the registered forces.
+         */
+        void rebuild();
+
+        /**
+         * Changes the storage order of the residues (see
+         * \p State::permute) to the order along a Morton (Z-order) curve
+         * over a grid of cells of the size of the cutoff distance extended
+         * by the padding; within a cell, the residues keep their relative
+         * order.
+         */
+        void sortSpatially();
+
+        /**
+         * Sets up a build for given positions and box, fixing the current
+         * parameters of the list (in particular the algorithm).
+         * @param b Build to set up.
+         * @param r Positions of the residues.
+         * @param top Topology (box) of the system.
+         * @param buildPad Padding to use.
+         * @param out Sublists to write to.
+         * @param numThreads Number of threads to use.
+         */
+        void prepareBuild(Build& b, Vectors const& r, Topology const& top,
+            double buildPad, std::vector<NeighbourList>& out,
+            int numThreads) const;
+
+        /**
+         * Builds the sublists with the algorithm selected for the build.
+         * @param b Build (see \p prepareBuild) to perform.
+         */
+        void build(Build& b);
+
+        void runHooks();
+
+        /**
+         * Snapshot of the state from which the list is being built in the
+         * background.
+         */
+        double snapT = 0.0;
+        Vectors snapR;
+        Topology snapTop;
+
+        /**
+         * Sublists being built in the background, swapped with \p sublists
+         * once ready.
+         */
+        std::vector<NeighbourList> nextSublists;
+
+        /**
+         * The reconstruction being performed in the background, if any.
+         */
+        std::future<void> pendingBuild;
+
+        /**
+         * Starts building the next list in the background from a snapshot of
+         * the current state.
+         */
+        void startBackgroundBuild();
+
+        /**
+         * Waits for the background reconstruction to finish, swaps in the
+         * new list and invokes the update hooks.
+         */
+        void finishBackgroundBuild();
+
+        /**
+         * Whether the lists are pruned; it's the value of \p prune at the
+         * first reconstruction.
+         */
+        bool pruning = false;
+
+        /**
+         * Full (unpruned) sublists, from which the pruned \p sublists are
+         * computed, if the lists are pruned.
+         */
+        std::vector<NeighbourList> outerSublists;
+
+        /**
+         * Positions and box at which the current pruned lists were computed.
          */
-        void updateGrid();
+        Vectors pruneR;
+        Topology pruneTop;
+
+        /**
+         * Pruned lists computed by the async task, along with the positions
+         * and box at which they were computed, to be swapped in at the next
+         * step, if \p prunePending is set.
+         */
+        std::vector<NeighbourList> nextPruned;
+        Vectors nextPruneR;
+        Topology nextPruneTop;
+        bool prunePending = false;
+
+        /**
+         * Sublists into which the reconstruction writes: \p outerSublists if
+         * the lists are pruned, \p sublists otherwise.
+         */
+        std::vector<NeighbourList>& builtSublists();
+
+        /**
+         * Makes the newly reconstructed lists current (pruning them if
+         * necessary) and invokes the update hooks.
+         */
+        void activate();
+
+        /**
+         * Computes the pruned lists, i.e. keeps only the pairs within the
+         * cutoff distance of their spec extended by \p prunePad at the
+         * current positions.
+         * @param in Lists to prune.
+         * @param out Pruned lists.
+         */
+        void pruneSublists(std::vector<NeighbourList> const& in,
+            std::vector<NeighbourList>& out) const;
+
+        /**
+         * Async task pruning the lists during the computation of the forces.
+         */
+        void pruneTask();
 
     public:
+        /**
+         * An extra "buffer". The list by default contains elements that may be
+         * outside the maximal cutoff, which allows us to not have to
+         * reconstruct the verlet list at every time step, at the cost of
+         * spurious distance comparisons. A change takes effect at the next
+         * reconstruction.
+         */
+        double pad = 10.0 * angstrom;
+
+        /**
+         * Algorithm used for reconstructing the list.
+         */
+        enum class Algorithm {
+            /**
+             * Use the cell version unless the system is so small that the
+             * overhead of the grid outweighs the gains, in which case use
+             * the all-pairs version.
+             */
+            AUTO,
+            /// Always go through all the pairs (see \p update).
+            ALL_PAIRS,
+            /// Always use the cell version (see \p updateGrid).
+            CELL
+        };
+
+        /**
+         * Algorithm used for reconstructing the list.
+         */
+        Algorithm algorithm = Algorithm::AUTO;
+
+        /**
+         * Minimal number of residues for which \p Algorithm::AUTO selects the
+         * cell version of the reconstruction.
+         */
+        int minCellResidues = 512;
+
+        /**
+         * Whether to build the lists in the background. In this mode, once
+         * a quarter of the displacement allowed by the padding is used up
+         * (i.e. half of the "budget" before a reconstruction is required),
+         * the next list is built on a separate thread from a snapshot of the
+         * positions, with the padding enlarged by \p backgroundExtraPad so as
+         * to accommodate the motion of the residues in the meantime. The new
+         * list is swapped in (and the update hooks invoked) at the beginning
+         * of a step once it's ready, so that the reconstruction mostly leaves
+         * the critical path. If the residues move too far before the list is
+         * ready, we wait for it, or rebuild the list synchronously should it
+         * be no longer valid.
+         *
+         * Note that the moment at which the new list is swapped in depends
+         * on timing; the forces are not affected (up to the potentials which
+         * track the pairs in the list, like the quasi-adiabatic one), since
+         * either list contains all the pairs within the cutoff distances.
+         */
+        bool background = false;
+
+        /**
+         * Extra padding for the lists built in the background.
+         */
+        double backgroundExtraPad = 2.0 * angstrom;
+
+        /**
+         * Number of (OpenMP) threads used for building the lists in the
+         * background. By default it's a single spare thread, so as not to
+         * compete with the computation of the forces.
+         */
+        int backgroundThreads = 1;
+
+        /**
+         * Whether to prune the lists. The pairs in the lists remain there
+         * until the next reconstruction, even if the residues are so far
+         * apart that they will not get within the cutoff distance before
+         * it. With pruning, the forces see the lists restricted to the pairs
+         * within the cutoff distance extended by \p prunePad (which is
+         * smaller than \p pad) at some reference positions; such lists stay
+         * valid until the residues move by half of \p prunePad from them.
+         * The pruning is performed by an async task during the computation
+         * of the forces, when half of the budget is used up, and the pruned
+         * lists are swapped in (and the update hooks invoked) at the next
+         * step, so that the force loops shrink over the lifetime of the
+         * full list. The option must be set before the simulation is
+         * initialized.
+         *
+         * The forces computed within the cutoff distances are not affected;
+         * note however that the quasi-adiabatic potential retains its
+         * contacts only as long as they are present in the list, and thus
+         * may drop the (breaking) contacts which drift apart sooner.
+         */
+        bool prune = false;
+
+        /**
+         * Whether to update the list incrementally when possible. Instead of
+         * using common reference positions, the residues have individual
+         * ones, and the list contains the pairs whose reference positions
+         * are within the cutoff distance extended by the padding. Once some
+         * residue moves by half of the padding from its reference position,
+         * rather than reconstructing the entire list, we give new reference
+         * positions only to the residues which have moved by more than a
+         * quarter of the padding, move them to the appropriate cells, and
+         * recompute the pairs involving them, so that the cost is (for the
+         * most part) proportional to the number of residues which have moved.
+         * This requires the list to have been built with the cell version,
+         * and the box to be unchanged; otherwise, or if too many residues
+         * have moved (see \p maxMovedFraction), the list is reconstructed.
+         */
+        bool incremental = false;
+
+        /**
+         * Maximal fraction of the residues which have moved for which the
+         * list is updated incrementally.
+         */
+        double maxMovedFraction = 0.25;
+
+        /**
+         * Padding of the pruned lists.
+         */
+        double prunePad = 4.0 * angstrom;
+
+        /**
+         * Whether to store the residues in a spatial order. At every
+         * (synchronous) reconstruction of the list, the residues are
+         * reordered along a space-filling curve (see \p State::permute),
+         * so that the pairs in the list, and the residues gathered by the
+         * pairwise forces, are close in memory. The order is not changed
+         * by the incremental updates or by the lists built in the
+         * background.
+         */
+        bool spatialOrder = false;
+
+        ~List();
+
         /**
          * Register a nonlocal force, in particular adjust the current specs
          * so as to accomodate the newly added force (for example increase the
@@ -155,14 +535,49 @@ namespace mdk::vl {
          * hooks to call when a list is reconstructed.
          * @param force Nonlocal force to register.
          * @param spec Spec with which to register the force.
+         * @return Index of the sublist (in \p sublists) for the force.
+         */
+        int registerNF(NonlocalForce& force, Spec const& spec);
+
+        /**
+         * Unregister a nonlocal force, so that its hook is no longer invoked
+         * and its sublist (unless shared with another force) is no longer
+         * computed; the cutoff distance and the bond separation of the list
+         * are adjusted to the remaining specs. It must be executed before
+         * the simulation is initialized.
+         * @param force Nonlocal force to unregister.
+         * @param idx Index of the sublist of the force, as returned by
+         * \p registerNF.
+         */
+        void unregisterNF(NonlocalForce& force, int idx);
+
+        /**
+         * Registers pairs of residues which are to be excluded from the
+         * nonlocal interactions other than the one which registers them
+         * (for example the native contacts). The exclusions are applied as
+         * the sublists are built, to the sublists of the specs with
+         * \p Spec::applyExclusions set, so the resulting lists do not depend
+         * on the order in which the forces were added. The forces which
+         * bypass the list check the exclusions with \p isExcluded.
+         * @param pairs Pairs to exclude, with i1 < i2.
+         */
+        void addExclusions(Pairs const& pairs);
+
+        /**
+         * Checks whether a pair of residues is excluded.
+         * @param i1 Index of the first residue.
+         * @param i2 Index of the second residue; must be larger than \p i1.
+         * @return Whether the pair is excluded.
          */
-        void registerNF(NonlocalForce& force, Spec const& spec);
+        bool isExcluded(int i1, int i2) const;
 
         /**
-         * The list of pairs. The pairs are ordered (if a pair [i, j] is in
-         * this list, then i < j).
+         * The sublists of pairs, one for every distinct spec registered, all
+         * computed in a single pass over the candidate pairs. A sublist
+         * contains the pairs within the cutoff distance of its spec (extended
+         * by the padding) and with at least the required bond separation.
          */
-        Pairs pairs;
+        std::vector<NeighbourList> sublists;
 
         void bind(Simulation& simulation) override;
 
@@ -171,5 +586,32 @@ namespace mdk::vl {
          * and invoke the relevant update hooks for the non-local forces.
          */
         void check();
+
+        /**
+         * Number of the updates of the list, i.e. the reconstructions (or
+         * incremental updates) and swaps of the lists built in the
+         * background.
+         */
+        int numUpdates = 0;
+
+        /**
+         * Total (wall-clock) time spent in the updates of the list, in
+         * seconds, including the update hooks of the forces.
+         */
+        double updateTime = 0.0;
+
+        /**
+         * Makes the list reconstructed (from scratch) at the next check, for
+         * example so that a change of \p pad or \p algorithm takes effect.
+         */
+        void invalidate();
+
+        /**
+         * Computes the fraction of the displacement allowed by the padding
+         * of the current list which has been used up; the list is updated
+         * once it reaches 1.
+         * @return Used-up fraction of the displacement.
+         */
+        double budgetUsed() const;
     };
 }
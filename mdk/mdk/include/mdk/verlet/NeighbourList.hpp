@@ -0,0 +1,162 @@
+#pragma once
+#include "../data/Primitives.hpp"
+#include <algorithm>
+
+namespace mdk::vl {
+    /**
+     * A "half" neighbour list in the CSR (compressed sparse row) format: for
+     * every residue i, the list contains the indices j > i of the residues
+     * paired with it, stored contiguously in \p js in the range
+     * [offsets[i], offsets[i+1]). The indices within a row are sorted, thus
+     * going through the rows in order yields the pairs in the lexicographic
+     * order. Compared to a list of pairs, it takes about half the memory,
+     * and can be constructed (with a counting sort into the rows) without
+     * sorting all the pairs.
+     */
+    class NeighbourList {
+    public:
+        /**
+         * Offsets of the rows in \p js; the size is equal to the number of
+         * residues plus one.
+         */
+        Integers offsets = { 0 };
+
+        /**
+         * Concatenated (sorted) rows of the indices of the paired residues.
+         */
+        Integers js;
+
+        /**
+         * @return Number of rows, i.e. residues.
+         */
+        int numRows() const {
+            return (int)offsets.size() - 1;
+        }
+
+        /**
+         * @return Number of pairs in the list.
+         */
+        int size() const {
+            return (int)js.size();
+        }
+
+        /**
+         * Invoke a function for every pair in the list, in the lexicographic
+         * order.
+         * @param f Function taking the indices i and j of the pair.
+         */
+        template<typename F>
+        void forEach(F&& f) const {
+            for (int i = 0; i < numRows(); ++i) {
+                for (int k = offsets[i]; k < offsets[i+1]; ++k) {
+                    f(i, js[k]);
+                }
+            }
+        }
+
+        /**
+         * Number of rows in a chunk, in the chunked operations.
+         */
+        static constexpr int chunkRows = 256;
+
+        /**
+         * @return Number of chunks of rows.
+         */
+        int numChunks() const {
+            return (numRows() + chunkRows - 1) / chunkRows;
+        }
+
+        /**
+         * Invoke a function for every chunk of consecutive rows. The chunks
+         * are processed in parallel, as OpenMP tasks (so that it may be used
+         * within other tasks); outside of a parallel region they are
+         * processed sequentially.
+         * @param f Function taking the index of the chunk and the range
+         * [iBegin, iEnd) of its rows.
+         */
+        template<typename F>
+        void forEachChunk(F const& f) const {
+            int n = numChunks();
+
+#pragma omp taskloop grainsize(1) shared(f)
+            for (int chunk = 0; chunk < n; ++chunk) {
+                int iBegin = chunk * chunkRows;
+                int iEnd = std::min(iBegin + chunkRows, numRows());
+                f(chunk, iBegin, iEnd);
+            }
+        }
+
+        /**
+         * Remove the pairs not satisfying a predicate. The chunks of rows
+         * are filtered in parallel (see \p forEachChunk), and the remaining
+         * pairs compacted with a prefix sum over the chunks. Within a chunk,
+         * the predicate is invoked for the pairs in the lexicographic order,
+         * which allows for it to be stateful (for example to merge the list
+         * with another ordered list), hence a separate predicate is made for
+         * each chunk.
+         * @param makePred Function taking the first row of a chunk, and
+         * returning the predicate (taking the indices i and j of a pair) for
+         * the chunk.
+         */
+        template<typename MakePred>
+        void filter(MakePred const& makePred) {
+            Integers newOffsets(offsets.size());
+            newOffsets[0] = 0;
+
+            std::vector<Integers> parts(numChunks());
+            forEachChunk([&](int chunk, int iBegin, int iEnd) -> void {
+                auto pred = makePred(iBegin);
+                auto& part = parts[chunk];
+                for (int i = iBegin; i < iEnd; ++i) {
+                    for (int k = offsets[i]; k < offsets[i+1]; ++k) {
+                        if (pred(i, js[k])) part.push_back(js[k]);
+                    }
+                    newOffsets[i+1] = (int)part.size();
+                }
+            });
+
+            Integers chunkStart(parts.size() + 1);
+            chunkStart[0] = 0;
+            for (int chunk = 0; chunk < (int)parts.size(); ++chunk) {
+                chunkStart[chunk+1] = chunkStart[chunk] + parts[chunk].size();
+            }
+
+            Integers newJs(chunkStart.back());
+            forEachChunk([&](int chunk, int iBegin, int iEnd) -> void {
+                for (int i = iBegin; i < iEnd; ++i) {
+                    newOffsets[i+1] += chunkStart[chunk];
+                }
+                std::copy(parts[chunk].begin(), parts[chunk].end(),
+                    newJs.begin() + chunkStart[chunk]);
+            });
+
+            offsets = std::move(newOffsets);
+            js = std::move(newJs);
+        }
+    };
+
+    /**
+     * Concatenates the lists computed for the consecutive chunks (see
+     * \p NeighbourList::forEachChunk), copying them in parallel.
+     * @param parts Lists for the chunks.
+     * @param out Concatenated list.
+     */
+    template<typename T>
+    void concatChunks(std::vector<std::vector<T>> const& parts,
+        std::vector<T>& out) {
+
+        Integers chunkStart(parts.size() + 1);
+        chunkStart[0] = 0;
+        for (int chunk = 0; chunk < (int)parts.size(); ++chunk) {
+            chunkStart[chunk+1] = chunkStart[chunk] + parts[chunk].size();
+        }
+
+        out.resize(chunkStart.back());
+
+#pragma omp taskloop grainsize(1) shared(parts, out, chunkStart)
+        for (int chunk = 0; chunk < (int)parts.size(); ++chunk) {
+            std::copy(parts[chunk].begin(), parts[chunk].end(),
+                out.begin() + chunkStart[chunk]);
+        }
+    }
+}
@@ -2,12 +2,11 @@
 
 namespace mdk::vl {
     /**
-     * A specification (spec for short) for the non-local force. Technically
-     * one could generate a Verlet list for every non-local force, however this
-     * would be wasteful - thus we generate a most restrictive possible Verlet
-     * list which contains the "sub-Verlet lists" of the particular non-local
-     * forces and let them filter the general list on their own accord into a
-     * local list.
+     * A specification (spec for short) for the non-local force. Rather than
+     * generating a separate Verlet list for every non-local force, we go
+     * through the candidate pairs once for the least restrictive of the specs
+     * and place each pair into the sublists of the specs it satisfies; the
+     * forces may then filter their sublists further on their own accord.
      */
     struct Spec {
         /**
@@ -20,5 +19,12 @@ namespace mdk::vl {
          * Verlet list. Technically this is just an optimization.
          */
         int minBondSep = 3;
+
+        /**
+         * Whether the excluded pairs (see \p List::addExclusions) are left
+         * out of the sublist. The force registering the exclusions keeps
+         * them, so as to find among them the pairs it acts on.
+         */
+        bool applyExclusions = true;
     };
 }
@@ -4,7 +4,8 @@
 using namespace mdk;
 
 void Chirality::bind(Simulation &simulation) {
-    Force::bind(simulation);
+    BondedForce::bind(simulation);
+    geometry = &simulation.var<ChainGeometry>();
     d0_cube_inv = Scalars(state->n);
     C_nat = Scalars(state->n);
 
@@ -30,23 +31,37 @@ void Chirality::bind(Simulation &simulation) {
 }
 
 void Chirality::asyncPart(Dynamics &dyn) {
+    if (fused) return;
+
+    #pragma omp for nowait
     for (int i = 0; i < (int)inRange.size(); ++i) {
-        if (!inRange[i]) continue;
+        residuePart(i, dyn);
+    }
+}
 
-        auto r1 = state->r[i-2], r2 = state->r[i-1],
-            r3 = state->r[i],   r4 = state->r[i+1];
-        auto r12 = r2 - r1, r23 = r3 - r2, r34 = r4 - r3;
-        auto r12_x_r23 = r12.cross(r23), r12_x_r34 = r12.cross(r34),
-            r23_x_r34 = r23.cross(r34);
-
-        auto C = r12.dot(r23_x_r34) * d0_cube_inv[i];
-        auto diffC = C - C_nat[i];
-        dyn.V += 0.5 * e_chi * diffC * diffC;
-
-        auto f = e_chi * diffC * d0_cube_inv[i];
-        dyn.F[i-2] += f * r23_x_r34;
-        dyn.F[i-1] -= f * (r12_x_r34 + r23_x_r34);
-        dyn.F[i] += f * (r12_x_r23 + r12_x_r34);
-        dyn.F[i+1] -= r12_x_r23;
+void Chirality::blockPart(int begin, int end, Dynamics &dyn) const {
+    end = std::min(end, (int) inRange.size());
+    for (int i = begin; i < end; ++i) {
+        residuePart(i, dyn);
     }
 }
+
+void Chirality::residuePart(int i, Dynamics &dyn) const {
+    if (!inRange[i]) return;
+
+    auto r12 = geometry->bond[i-2], r34 = geometry->bond[i];
+    auto r12_x_r23 = geometry->bondCross[i-1],
+        r23_x_r34 = geometry->bondCross[i];
+    auto r12_x_r34 = r12.cross(r34);
+
+    auto C = r12.dot(r23_x_r34) * d0_cube_inv[i];
+    auto diffC = C - C_nat[i];
+    dyn.V += 0.5 * e_chi * diffC * diffC;
+
+    auto f = e_chi * diffC * d0_cube_inv[i];
+    auto const& idx = state->sortedIdx;
+    dyn.F[idx[i-2]] += f * r23_x_r34;
+    dyn.F[idx[i-1]] -= f * (r12_x_r34 + r23_x_r34);
+    dyn.F[idx[i]] += f * (r12_x_r23 + r12_x_r34);
+    dyn.F[idx[i+1]] -= r12_x_r23;
+}
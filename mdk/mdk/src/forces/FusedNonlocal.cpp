@@ -0,0 +1,76 @@
+#include "forces/FusedNonlocal.hpp"
+#include "simul/Simulation.hpp"
+#include <stdexcept>
+using namespace mdk;
+
+void FusedNonlocal::bind(Simulation &simulation) {
+    NonlocalForce::bind(simulation);
+
+    chains = &simulation.data<Chains>();
+
+    for (auto* term: terms) {
+        if (!term->fusible() || term->fused || term->vlIdx < 0) {
+            throw std::runtime_error("Cannot fuse the nonlocal force");
+        }
+
+        if (!term->savedSpec.applyExclusions) {
+            throw std::runtime_error("Cannot fuse a nonlocal force which "
+                "does not apply the exclusions");
+        }
+
+        vl->unregisterNF(*term, term->vlIdx);
+        term->vlIdx = -1;
+        term->fused = true;
+    }
+
+    installIntoVL();
+}
+
+vl::Spec FusedNonlocal::spec() const {
+    vl::Spec fusedSpec;
+    fusedSpec.cutoffSq = 0.0;
+    fusedSpec.minBondSep = terms.empty() ? 0 : terms[0]->savedSpec.minBondSep;
+
+    for (auto* term: terms) {
+        auto const& termSpec = term->savedSpec;
+        fusedSpec.cutoffSq = std::max(fusedSpec.cutoffSq, termSpec.cutoffSq);
+        fusedSpec.minBondSep = std::min(fusedSpec.minBondSep,
+            termSpec.minBondSep);
+    }
+
+    return fusedSpec;
+}
+
+void FusedNonlocal::asyncPart(Dynamics &dyn) {
+    auto const& pairs = vlPairs();
+
+    #pragma omp for schedule(dynamic, 64) nowait
+    for (int i1 = 0; i1 < pairs.numRows(); ++i1) {
+        for (int k = pairs.offsets[i1]; k < pairs.offsets[i1+1]; ++k) {
+            auto i2 = pairs.js[k];
+            auto r12 = state->top(state->r[i1] - state->r[i2]);
+            auto x2 = r12.squaredNorm();
+            if (x2 > savedSpec.cutoffSq) continue;
+
+            vl::PairInfo pair;
+            pair.i1 = i1;
+            pair.i2 = i2;
+            pair.norm = sqrt(x2);
+            pair.unit = r12 / pair.norm;
+
+            for (auto* term: terms) {
+                auto const& termSpec = term->savedSpec;
+                if (x2 > termSpec.cutoffSq ||
+                    !chains->sepByAtLeastN(state->origIdx[i1],
+                        state->origIdx[i2], termSpec.minBondSep)) {
+
+                    continue;
+                }
+
+                term->fusedPairPart(pair, dyn);
+            }
+        }
+    }
+}
+
+void FusedNonlocal::vlUpdateHook() {}
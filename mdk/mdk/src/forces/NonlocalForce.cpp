@@ -9,5 +9,12 @@ void NonlocalForce::bind(Simulation &simulation) {
 
 void NonlocalForce::installIntoVL() {
     savedSpec = spec();
-    vl->registerNF(*this, savedSpec);
-}
\ No newline at end of file
+    vlIdx = vl->registerNF(*this, savedSpec);
+}
+
+bool NonlocalForce::fusible() const {
+    return false;
+}
+
+void NonlocalForce::fusedPairPart(vl::PairInfo const& pair,
+    Dynamics& dynamics) const {}
\ No newline at end of file
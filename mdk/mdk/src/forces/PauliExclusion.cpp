@@ -1,13 +1,29 @@
 #include "forces/PauliExclusion.hpp"
+#include "simul/Simulation.hpp"
+#include "forces/PairForce.hpp"
 #include <mdk/data/Chains.hpp>
 using namespace mdk;
 
-PauliExclusion::PauliExclusion() :
-    stlj(5.0 * angstrom, 1.0 * eps) {}
+extern Vectors cellFTP;
+
+#pragma omp threadprivate(cellFTP)
+
+Vectors cellFTP;
+
+PauliExclusion::PauliExclusion(Mode mode) :
+    stlj(5.0 * angstrom, 1.0 * eps), mode(mode) {}
 
 void PauliExclusion::bind(Simulation &simulation) {
     NonlocalForce::bind(simulation);
-    installIntoVL();
+    simulation.var<State>().useShadow();
+
+    if (mode == Mode::CELL_DIRECT) {
+        savedSpec = spec();
+        chains = &simulation.data<Chains>();
+    }
+    else {
+        installIntoVL();
+    }
 }
 
 vl::Spec PauliExclusion::spec() const {
@@ -17,20 +33,84 @@ vl::Spec PauliExclusion::spec() const {
     };
 }
 
+void PauliExclusion::perCellPair(int c1, int c2, double &V, Vectors &cellF) {
+    auto const& cellStart = cells.cellStart;
+    auto const& cellIdx = cells.cellIdx;
+    auto const& cellR = cells.cellR;
+
+    for (int k1 = cellStart[c1]; k1 < cellStart[c1+1]; ++k1) {
+        auto i1 = cellIdx[k1];
+
+        /* Within a single cell, we only take the residues which come later
+         * in the cell, so that each pair is considered once.
+         */
+        auto start2 = c1 == c2 ? k1 + 1 : cellStart[c2];
+        for (int k2 = start2; k2 < cellStart[c2+1]; ++k2) {
+            auto i2 = cellIdx[k2];
+            auto orig1 = state->origIdx[i1], orig2 = state->origIdx[i2];
+            if (!chains->sepByAtLeastN(orig1, orig2, savedSpec.minBondSep))
+                continue;
+
+            auto r12 = state->top(cellR[k1] - cellR[k2]);
+            auto x2 = r12.squaredNorm();
+            if (x2 > savedSpec.cutoffSq) continue;
+
+            /* The pairs excluded from the Verlet list (like the native
+             * contacts) are excluded here as well.
+             */
+            if (vl->isExcluded(std::min(orig1, orig2), std::max(orig1, orig2)))
+                continue;
+
+            auto x = sqrt(x2);
+            auto unit = r12/x;
+
+            stlj.computeF(unit, x, V, cellF[k1], cellF[k2]);
+        }
+    }
+}
+
 void PauliExclusion::asyncPart(Dynamics &dyn) {
-    #pragma omp for nowait
-    for (auto const& [i1, i2]: exclPairs) {
-        auto r12 = state->top(state->r[i1] - state->r[i2]);
-        auto x2 = r12.squaredNorm();
-        if (x2 > savedSpec.cutoffSq) continue;
+    if (fused) return;
+
+    if (mode == Mode::CELL_DIRECT) {
+        cells.build(state->r, state->top, stlj.r_cut);
+
+        /* The forces are accumulated in the cell order, in which the pairs
+         * of residues close in space are close in memory, and scattered
+         * back to the residues at the end.
+         */
+        auto& cellF = cellFTP;
+        if (cellF.size() != state->n)
+            cellF = Vectors(state->n);
+        cellF.setZero();
+
+        #pragma omp for schedule(dynamic, 64) nowait
+        for (int c1 = 0; c1 < cells.numCells; ++c1) {
+            cells.forEachHalfShell(c1, [&](int c2) -> void {
+                perCellPair(c1, c2, dyn.V, cellF);
+            });
+        }
 
-        auto x = sqrt(x2);
-        auto unit = r12/x;
+        for (int k = 0; k < state->n; ++k) {
+            dyn.F[cells.cellIdx[k]] += cellF[k];
+        }
 
-        stlj.computeF(unit, x, dyn.V, dyn.F[i1], dyn.F[i2]);
+        return;
     }
+
+    PairForce<ShiftedTruncatedLJ>(savedSpec.cutoffSq).compute(vlPairs(),
+        stlj, *state, dyn);
 }
 
-void PauliExclusion::vlUpdateHook() {
-    exclPairs = vl->pairs;
+bool PauliExclusion::fusible() const {
+    return mode == Mode::VERLET_LIST;
 }
+
+void PauliExclusion::fusedPairPart(vl::PairInfo const& pair,
+    Dynamics &dyn) const {
+
+    stlj.computeF(pair.unit, pair.norm, dyn.V, dyn.F[pair.i1],
+        dyn.F[pair.i2]);
+}
+
+void PauliExclusion::vlUpdateHook() {}
@@ -53,9 +53,12 @@ void PseudoImproperDihedral::deriveAngles(vl::PairInfo const& pair,
         int i1 = idx[m]-1, i2 = idx[m], i3 = idx[m];
         int loc1 = 3*m, loc2 = 3*m+1, loc3 = 3*m+2, loc4 = 3*(1-m)+1;
 
-        Vector r1 = state->r[i1], r2 = state->r[i2], r3 = state->r[i3];
+        auto const& sorted = state->sortedIdx;
+        Vector r1 = state->r[sorted[i1]], r2 = state->r[sorted[i2]],
+            r3 = state->r[sorted[i3]];
         Vector r24 = (m == 0 ? 1 : -1) * pair.norm * pair.unit;
-        Vector r12 = r2 - r1, r23 = r3 - r2, r13 = r3 - r1, r14 = r12 + r24;
+        Vector r12 = geometry->bond[i1], r23 = r3 - r2, r13 = r3 - r1,
+            r14 = r12 + r24;
 
         Vector rij = -r23, rkj = -r13, rkl = -r14;
         Vector rm = -r12.cross(r23);
@@ -89,6 +92,7 @@ void PseudoImproperDihedral::bind(Simulation &simulation) {
 
     types = &simulation.data<Types>();
     seqs = &simulation.data<Chains>();
+    geometry = &simulation.var<ChainGeometry>();
 
     bb_neg_lj.r_min = 6.2 * angstrom;
     bb_neg_lj.depth = 1.0 * eps;
@@ -129,70 +133,103 @@ vl::Spec PseudoImproperDihedral::spec() const {
 
     return (vl::Spec) {
         .cutoffSq = pow(maxCutoff, 2.0),
-        .minBondSep = 3,
+        .minBondSep = 4,
     };
 }
 
 void PseudoImproperDihedral::asyncPart(Dynamics &dyn) {
-    for (auto const& [i1, i2]: pairs) {
-        auto r12 = state->top(state->r[i1] - state->r[i2]);
-        auto r12_normsq = r12.squaredNorm();
-        if (r12_normsq >= savedSpec.cutoffSq) continue;
-
-        auto norm = sqrt(r12_normsq);
-        auto unit = r12 / norm;
-        vl::PairInfo pair;
-        pair.i1 = i1;
-        pair.i2 = i2;
-        pair.norm = norm;
-        pair.unit = unit;
-
-        double psi[2];
-        Vector dpsi_dr[2][6];
-
-        deriveAngles(pair, psi, dpsi_dr);
-
-        /* PID potential is described by a formula:
-         *   \sum_i \lambda_i(\psi_{12}) \lambda_i(\psi_{21}) \phi(r_{12})
-         * Thus the derivative wrt q is:
-         *   \sum_i (d\lambda_i/d\psi) d\psi_{12}/dq \lambda_i(\psi_{21}) \phi(r_{12}) +
-         *          \lambda_i (d\lambda_i/d\psi) d\psi_{21}/dq \phi(r_{12}) +
-         *          \lambda_i(\psi_{12}) \lambda_i(\psi_{21}) d\phi/dq
-         *   = A d\psi_{12}/dq + B d\psi_{21}/dq + C d\phi/dq
-         */
-
-        double A = 0.0, B = 0.0, C = 0.0;
-        auto type1 = (int8_t)(*types)[i1], type2 = (int8_t)(*types)[i2];
-
-        perLambda(bb_pos, bb_pos_lj,
-            psi, norm, A, B, C);
-
-        perLambda(bb_neg, bb_neg_lj,
-            psi, norm, A, B, C);
-
-        perLambda(ss, ss_ljs[type1][type2],
-            psi, norm, A, B, C);
-
-        int idx[6] = { i1-1, i1, i1 + 1, i2-1, i2, i2+1 };
-        for (int i = 0; i < 6; ++i) {
-            dyn.F[idx[i]] -= A * dpsi_dr[0][i];
-            dyn.F[idx[i]] -= B * dpsi_dr[1][i];
+    if (fused) return;
+
+    /* The rows of the list are shared between the threads, as in
+     * FusedNonlocal::asyncPart, with the same cutoff test.
+     */
+    auto const& pairs = vlPairs();
+
+    #pragma omp for schedule(dynamic, 64) nowait
+    for (int i1 = 0; i1 < pairs.numRows(); ++i1) {
+        if (seqs->isTerminal[state->origIdx[i1]]) continue;
+
+        for (int k = pairs.offsets[i1]; k < pairs.offsets[i1+1]; ++k) {
+            auto i2 = pairs.js[k];
+            if (seqs->isTerminal[state->origIdx[i2]]) continue;
+
+            auto r12 = state->top(state->r[i1] - state->r[i2]);
+            auto r12_normsq = r12.squaredNorm();
+            if (r12_normsq > savedSpec.cutoffSq) continue;
+
+            auto norm = sqrt(r12_normsq);
+            auto unit = r12 / norm;
+            vl::PairInfo pair;
+            pair.i1 = i1;
+            pair.i2 = i2;
+            pair.norm = norm;
+            pair.unit = unit;
+
+            pairPart(pair, dyn);
         }
-        dyn.F[i1] += C * unit;
-        dyn.F[i2] -= C * unit;
     }
 }
 
-void PseudoImproperDihedral::vlUpdateHook() {
-    pairs.clear();
-    for (auto const& [i1, i2]: vl->pairs) {
-        bool cond = seqs->sepByAtLeastN(i1, i2, 4) &&
-            !seqs->isTerminal[i1] &&
-            !seqs->isTerminal[i2];
+void PseudoImproperDihedral::pairPart(vl::PairInfo const& pair,
+    Dynamics &dyn) const {
 
-        if (cond) {
-            pairs.emplace_back(i1, i2);
-        }
+    /* The pair comes in the storage order of the residues, while the
+     * geometry of the chains and the types are in the original one.
+     */
+    auto const& sorted = state->sortedIdx;
+    vl::PairInfo origPair = pair;
+    origPair.i1 = state->origIdx[pair.i1];
+    origPair.i2 = state->origIdx[pair.i2];
+
+    auto i1 = origPair.i1, i2 = origPair.i2;
+    auto norm = pair.norm;
+    auto const& unit = pair.unit;
+
+    double psi[2];
+    Vector dpsi_dr[2][6];
+
+    deriveAngles(origPair, psi, dpsi_dr);
+
+    /* PID potential is described by a formula:
+     *   \sum_i \lambda_i(\psi_{12}) \lambda_i(\psi_{21}) \phi(r_{12})
+     * Thus the derivative wrt q is:
+     *   \sum_i (d\lambda_i/d\psi) d\psi_{12}/dq \lambda_i(\psi_{21}) \phi(r_{12}) +
+     *          \lambda_i (d\lambda_i/d\psi) d\psi_{21}/dq \phi(r_{12}) +
+     *          \lambda_i(\psi_{12}) \lambda_i(\psi_{21}) d\phi/dq
+     *   = A d\psi_{12}/dq + B d\psi_{21}/dq + C d\phi/dq
+     */
+
+    double A = 0.0, B = 0.0, C = 0.0;
+    auto type1 = (int8_t)(*types)[i1], type2 = (int8_t)(*types)[i2];
+
+    perLambda(bb_pos, bb_pos_lj,
+        psi, norm, A, B, C);
+
+    perLambda(bb_neg, bb_neg_lj,
+        psi, norm, A, B, C);
+
+    perLambda(ss, ss_ljs[type1][type2],
+        psi, norm, A, B, C);
+
+    int idx[6] = { i1-1, i1, i1 + 1, i2-1, i2, i2+1 };
+    for (int i = 0; i < 6; ++i) {
+        dyn.F[sorted[idx[i]]] -= A * dpsi_dr[0][i];
+        dyn.F[sorted[idx[i]]] -= B * dpsi_dr[1][i];
     }
+    dyn.F[pair.i1] += C * unit;
+    dyn.F[pair.i2] -= C * unit;
+}
+
+bool PseudoImproperDihedral::fusible() const {
+    return true;
+}
+
+void PseudoImproperDihedral::fusedPairPart(vl::PairInfo const& pair,
+    Dynamics &dyn) const {
+
+    if (seqs->isTerminal[state->origIdx[pair.i1]] ||
+        seqs->isTerminal[state->origIdx[pair.i2]]) return;
+    pairPart(pair, dyn);
 }
 
+void PseudoImproperDihedral::vlUpdateHook() {}
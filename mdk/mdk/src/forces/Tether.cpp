@@ -8,7 +8,7 @@ Tether::Tether(bool fromNative) {
 }
 
 void Tether::bind(Simulation &simulation) {
-    Force::bind(simulation);
+    BondedForce::bind(simulation);
     n = state->n;
     dist0 = Scalars::Constant(n, 3.8 * angstrom);
     isConnected = Bytes(n, false);
@@ -35,16 +35,29 @@ void Tether::bind(Simulation &simulation) {
 }
 
 void Tether::asyncPart(Dynamics &dyn) {
+    if (fused) return;
+
     #pragma omp for nowait
     for (int i = 0; i < n - 1; ++i) {
-        if (not isConnected[i]) continue;
-        
-        auto r1 = state->r[i], r2 = state->r[i+1];
-        auto r12 = r2 - r1;
-        auto r12_norm = r12.norm();
-
-        auto dx = r12_norm - dist0[i];
-        auto r12_unit = r12 / r12_norm;
-        harm.computeF(r12_unit, dx, dyn.V, dyn.F[i], dyn.F[i+1]);
+        residuePart(i, dyn);
+    }
+}
+
+void Tether::blockPart(int begin, int end, Dynamics &dyn) const {
+    for (int i = begin; i < std::min(end, n - 1); ++i) {
+        residuePart(i, dyn);
     }
 }
+
+void Tether::residuePart(int i, Dynamics &dyn) const {
+    if (not isConnected[i]) return;
+
+    auto i1 = state->sortedIdx[i], i2 = state->sortedIdx[i+1];
+    auto r1 = state->r[i1], r2 = state->r[i2];
+    auto r12 = r2 - r1;
+    auto r12_norm = r12.norm();
+
+    auto dx = r12_norm - dist0[i];
+    auto r12_unit = r12 / r12_norm;
+    harm.computeF(r12_unit, dx, dyn.V, dyn.F[i1], dyn.F[i2]);
+}
@@ -4,41 +4,88 @@ using namespace mdk;
 using namespace std;
 
 void BondAngles::bind(Simulation &simulation) {
-    Force::bind(simulation);
+    BondedForce::bind(simulation);
     inRange = simulation.data<Chains>().triples;
+    geometry = &simulation.var<ChainGeometry>();
+
+    /* The records are zero until a part is bound, so that the force without
+     * any parts has no effect.
+     */
+    updateRecords();
+}
+
+void BondAngles::updateRecords() {
+    records.assign(inRange.size(), Record());
+    CBA = natBA ? natBA->CBA : 0.0;
+
+    for (int i = 0; i < (int) inRange.size(); ++i) {
+        if (!inRange[i]) continue;
+
+        auto& rec = records[i];
+        rec.native = natBA && natBA->isNative[i];
+        rec.theta0 = rec.native ? natBA->theta0[i] : 0.0;
+        for (int d = 0; d <= HeuresticBA::D; ++d) {
+            rec.coeff[d] = heurBA ? heurBA->coeff[heurBA->angleTypes[i]][d]
+                : 0.0;
+        }
+    }
 }
 
 void BondAngles::asyncPart(Dynamics &dyn) {
+    if (fused) return;
+
     #pragma omp for nowait
     for (int i = 0; i < (int) inRange.size(); ++i) {
-        if (!inRange[i]) continue;
+        residuePart(i, dyn);
+    }
+}
 
-        auto r1 = state->r[i-1], r2 = state->r[i], r3 = state->r[i+1];
-        auto r12 = r2 - r1, r23 = r3 - r2;
+void BondAngles::blockPart(int begin, int end, Dynamics &dyn) const {
+    end = std::min(end, (int) inRange.size());
+    for (int i = begin; i < end; ++i) {
+        residuePart(i, dyn);
+    }
+}
 
-        auto r12_x_r23 = r12.cross(r23);
-        double r12_x_r23_norm = r12_x_r23.norm();
-        if (r12_x_r23_norm != 0.0) {
-            double r12_norm = r12.norm(), r23_norm = r23.norm();
+void BondAngles::residuePart(int i, Dynamics &dyn) const {
+    if (!inRange[i]) return;
 
-            Vector dtheta_dr1 = r12.cross(r12_x_r23).normalized() / r12_norm;
-            Vector dtheta_dr3 = r23.cross(r12_x_r23).normalized() / r23_norm;
-            Vector dtheta_dr2 = -dtheta_dr1 - dtheta_dr3;
+    auto r12 = geometry->bond[i-1], r23 = geometry->bond[i];
 
-            double cos_theta = -r12.dot(r23) / r12_norm / r23_norm;
-            cos_theta = max(min(cos_theta, 1.0), -1.0);
-            double theta = acos(cos_theta), dV_dtheta = 0.0;
+    auto r12_x_r23 = geometry->bondCross[i];
+    double r12_x_r23_norm = r12_x_r23.norm();
+    if (r12_x_r23_norm != 0.0) {
+        double r12_norm = geometry->bondNorm[i-1],
+            r23_norm = geometry->bondNorm[i];
 
-            if (natBA && natBA->isNative[i]) {
-                natBA->term(i, theta, dyn.V, dV_dtheta);
-            }
-            else if (heurBA) {
-                heurBA->term(i, theta, dyn.V, dV_dtheta);
-            }
+        /* As r12 and r23 are perpendicular to r12 x r23, the norms of the
+         * cross products below are |r12| |r12 x r23| and |r23| |r12 x r23|,
+         * so they needn't be normalized separately.
+         */
+        Vector dtheta_dr1 = r12.cross(r12_x_r23) /
+            (r12_norm * r12_norm * r12_x_r23_norm);
+        Vector dtheta_dr3 = r23.cross(r12_x_r23) /
+            (r23_norm * r23_norm * r12_x_r23_norm);
+        Vector dtheta_dr2 = -dtheta_dr1 - dtheta_dr3;
 
-            dyn.F[i-1] -= dV_dtheta * dtheta_dr1;
-            dyn.F[i] -= dV_dtheta * dtheta_dr2;
-            dyn.F[i+1] -= dV_dtheta * dtheta_dr3;
-        }
+        double cos_theta = -r12.dot(r23) / r12_norm / r23_norm;
+        cos_theta = max(min(cos_theta, 1.0), -1.0);
+        double theta = acos(cos_theta);
+
+        auto const& rec = records[i];
+        double V_heur = 0.0, dV_heur = 0.0;
+        HeuresticBA::eval(rec.coeff, theta, V_heur, dV_heur);
+
+        double V_nat = 0.0, dV_nat = 0.0;
+        NativeBA::eval(CBA, rec.theta0, theta, V_nat, dV_nat);
+
+        dyn.V += rec.native ? V_nat : V_heur;
+        double dV_dtheta = rec.native ? dV_nat : dV_heur;
+
+        auto const& idx = state->sortedIdx;
+
+        dyn.F[idx[i-1]] -= dV_dtheta * dtheta_dr1;
+        dyn.F[idx[i]] -= dV_dtheta * dtheta_dr2;
+        dyn.F[idx[i+1]] -= dV_dtheta * dtheta_dr3;
     }
 }
@@ -27,4 +27,5 @@ void HeuresticBA::bind(Simulation &simulation) {
 
     auto& unifiedBA = simulation.var<BondAngles>();
     unifiedBA.heurBA = this;
+    unifiedBA.updateRecords();
 }
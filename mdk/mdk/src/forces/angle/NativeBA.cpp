@@ -23,4 +23,5 @@ void NativeBA::bind(Simulation &simulation) {
 
     auto& unifiedBA = simulation.var<BondAngles>();
     unifiedBA.natBA = this;
+    unifiedBA.updateRecords();
 }
\ No newline at end of file
@@ -6,4 +6,5 @@ void ComplexNativeDihedral::bind(Simulation &simulation) {
     NativeDihedralBase::bind(simulation);
     auto& unifiedDih = simulation.var<DihedralAngles>();
     unifiedDih.natDih = this;
+    unifiedDih.updateRecords();
 }
\ No newline at end of file
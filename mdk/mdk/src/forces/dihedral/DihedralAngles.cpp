@@ -3,59 +3,116 @@
 using namespace mdk;
 
 void DihedralAngles::bind(Simulation &simulation) {
-    Force::bind(simulation);
+    BondedForce::bind(simulation);
     inRange = simulation.data<Chains>().quads;
+    geometry = &simulation.var<ChainGeometry>();
+
+    /* The records are zero until a part is bound, so that the force without
+     * any parts has no effect.
+     */
+    updateRecords();
 }
 
-void DihedralAngles::asyncPart(Dynamics &dyn) {
-    #pragma omp for nowait
+void DihedralAngles::updateRecords() {
+    records.assign(inRange.size(), Record());
+
+    Scalars const* phi0 = std::visit([&](auto natPart) -> Scalars const* {
+        if constexpr (!std::is_same_v<decltype(natPart), std::monostate>)
+            return &natPart->phi0;
+        else
+            return nullptr;
+    }, natDih);
+
     for (int i = 0; i < (int) inRange.size(); ++i) {
         if (!inRange[i]) continue;
 
-        auto r1 = state->r[i-2], r2 = state->r[i-1],
-            r3 = state->r[i],   r4 = state->r[i+1];
-        auto r12 = r2 - r1, r23 = r3 - r2, r34 = r4 - r3;
-        auto r23_norm = r23.norm();
+        auto& rec = records[i];
+        for (int k = 0; k < 6; ++k) {
+            rec.C[k] = heurDih ? heurDih->coeff[heurDih->angleTypes[i]][k]
+                : 0.0;
+        }
+        rec.phi0 = phi0 ? (*phi0)[i] : 0.0;
+        rec.cos_phi0 = cos(rec.phi0);
+        rec.sin_phi0 = sin(rec.phi0);
+    }
+}
+
+void DihedralAngles::asyncPart(Dynamics &dyn) {
+    if (fused) return;
+
+    std::visit([&](auto natPart) -> void {
+        #pragma omp for nowait
+        for (int i = 0; i < (int) inRange.size(); ++i) {
+            perQuad(i, natPart, dyn);
+        }
+    }, natDih);
+}
+
+void DihedralAngles::blockPart(int begin, int end, Dynamics &dyn) const {
+    end = std::min(end, (int) inRange.size());
+    std::visit([&](auto natPart) -> void {
+        for (int i = begin; i < end; ++i) {
+            perQuad(i, natPart, dyn);
+        }
+    }, natDih);
+}
+
+template<typename Native>
+void DihedralAngles::perQuad(int i, Native natPart, Dynamics &dyn) const {
+    if (!inRange[i]) return;
+
+    auto r12 = geometry->bond[i-2], r23 = geometry->bond[i-1],
+        r34 = geometry->bond[i];
+    auto r23_norm = geometry->bondNorm[i-1];
+
+    auto r12_x_r23 = geometry->bondCross[i-1],
+        r23_x_r34 = geometry->bondCross[i];
+    auto r12_x_r23_normsq = r12_x_r23.squaredNorm();
+    auto r23_x_r34_normsq = r23_x_r34.squaredNorm();
 
-        auto r12_x_r23 = r12.cross(r23), r23_x_r34 = r23.cross(r34);
-        auto r12_x_r23_normsq = r12_x_r23.squaredNorm();
-        auto r23_x_r34_normsq = r23_x_r34.squaredNorm();
+    if (r12_x_r23_normsq != 0.0 && r23_x_r34_normsq != 0.0) {
+        auto r12_x_r23_norm = sqrt(r12_x_r23_normsq);
+        auto unit_r12_x_r23 = r12_x_r23 / r12_x_r23_norm;
 
-        if (r12_x_r23_normsq != 0.0 && r23_x_r34_normsq != 0.0) {
-            auto r12_x_r23_norm = sqrt(r12_x_r23_normsq);
-            auto unit_r12_x_r23 = r12_x_r23 / r12_x_r23_norm;
+        auto r23_x_r34_norm = sqrt(r23_x_r34_normsq);
+        auto unit_r23_x_r34 = r23_x_r34 / r23_x_r34_norm;
 
-            auto r23_x_r34_norm = sqrt(r23_x_r34_normsq);
-            auto unit_r23_x_r34 = r23_x_r34 / r23_x_r34_norm;
+        /* Since r12 x (r23 x r34) . r23 = |r23|^2 (r12 x r23) . r34, the
+         * sine of the angle follows from the same products as the cosine;
+         * the angle itself is only needed for the simple native variant.
+         */
+        auto cos_phi = unit_r12_x_r23.dot(unit_r23_x_r34);
+        auto sin_phi = r23_norm * r12_x_r23.dot(r34) /
+            (r12_x_r23_norm * r23_x_r34_norm);
+        double dV_dphi = 0.0;
 
-            auto cos_phi = unit_r12_x_r23.dot(unit_r23_x_r34);
+        auto const& rec = records[i];
+        if constexpr (std::is_same_v<Native, SimpleNativeDihedral*>) {
             cos_phi = std::max(std::min(cos_phi, 1.0), -1.0);
-            auto phi = acos(cos_phi), dV_dphi = 0.0;
+            auto phi = acos(cos_phi);
             if (r12_x_r23.dot(r34) < 0.0) phi = -phi;
-
-            if (std::holds_alternative<ComplexNativeDihedral*>(natDih)) {
-                auto *compNatDih = std::get<ComplexNativeDihedral*>(natDih);
-                compNatDih->term(i, phi, dyn.V, dV_dphi);
-            }
-            else if (std::holds_alternative<SimpleNativeDihedral*>(natDih)) {
-                auto *simpNatDih = std::get<SimpleNativeDihedral*>(natDih);
-                simpNatDih->term(i, phi, dyn.V, dV_dphi);
-            }
-            else if (heurDih) {
-                heurDih->term(i, phi, dyn.V, dV_dphi);
-            }
-
-            auto dphi_dr1 = -unit_r12_x_r23 * r23_norm / r12_x_r23_norm;
-            auto dphi_dr4 = unit_r23_x_r34 * r23_norm / r23_x_r34_norm;
-            Vector df = (-dphi_dr1*r12.dot(r23)+dphi_dr4*r23.dot(r34));
-            df /= (r23_norm * r23_norm);
-            auto dphi_dr2 = -dphi_dr1 + df;
-            auto dphi_dr3 = -dphi_dr4 - df;
-
-            dyn.F[i-2] -= dV_dphi * dphi_dr1;
-            dyn.F[i-1] -= dV_dphi * dphi_dr2;
-            dyn.F[i] -= dV_dphi * dphi_dr3;
-            dyn.F[i+1] -= dV_dphi * dphi_dr4;
+            natPart->eval(rec.phi0, phi, dyn.V, dV_dphi);
+        }
+        else if constexpr (std::is_same_v<Native, ComplexNativeDihedral*>) {
+            natPart->eval(rec.cos_phi0, rec.sin_phi0, cos_phi, sin_phi,
+                dyn.V, dV_dphi);
+        }
+        else {
+            HeuresticDihedral::eval(rec.C, cos_phi, sin_phi, dyn.V, dV_dphi);
         }
+
+        auto dphi_dr1 = -unit_r12_x_r23 * r23_norm / r12_x_r23_norm;
+        auto dphi_dr4 = unit_r23_x_r34 * r23_norm / r23_x_r34_norm;
+        Vector df = (-dphi_dr1*r12.dot(r23)+dphi_dr4*r23.dot(r34));
+        df /= (r23_norm * r23_norm);
+        auto dphi_dr2 = -dphi_dr1 + df;
+        auto dphi_dr3 = -dphi_dr4 - df;
+
+        auto const& idx = state->sortedIdx;
+
+        dyn.F[idx[i-2]] -= dV_dphi * dphi_dr1;
+        dyn.F[idx[i-1]] -= dV_dphi * dphi_dr2;
+        dyn.F[idx[i]] -= dV_dphi * dphi_dr3;
+        dyn.F[idx[i+1]] -= dV_dphi * dphi_dr4;
     }
 }
@@ -29,4 +29,5 @@ void HeuresticDihedral::bind(Simulation &simulation) {
 
     auto& unifiedDih = simulation.var<DihedralAngles>();
     unifiedDih.heurDih = this;
+    unifiedDih.updateRecords();
 }
@@ -1,4 +1,5 @@
 #include "forces/es/ConstDH.hpp"
+#include "forces/PairForce.hpp"
 using namespace mdk;
 
 vl::Spec mdk::ConstDH::spec() const {
@@ -8,22 +9,50 @@ vl::Spec mdk::ConstDH::spec() const {
     };
 }
 
-void ConstDH::asyncPart(Dynamics &dyn) {
+DebyeHueckel ConstDH::kernel(double q1_x_q2) const {
     auto coeff = pow(echarge, 2.0) / (4.0 * M_PI * permittivity);
+    return DebyeHueckel(coeff * q1_x_q2, screeningDist, false);
+}
+
+void ConstDH::vlUpdateHook() {
+    ESBase::vlUpdateHook();
+
+    if (tabulated && tables[0].numSegments() == 0) {
+        tables[0] = TabulatedKernel<DebyeHueckel>(kernel(-1.0), tableMinDist);
+        tables[1] = TabulatedKernel<DebyeHueckel>(kernel(1.0), tableMinDist);
+    }
+}
 
-    for (auto const& p: pairs) {
-        auto r12 = state->top(state->r[p.i1] - state->r[p.i2]);
-        auto x2 = r12.squaredNorm();
-        if (x2 > savedSpec.cutoffSq) continue;
+void ConstDH::asyncPart(Dynamics &dyn) {
+    if (fused) return;
+
+    if (tabulated) {
+        using Tabulated = TabulatedKernel<DebyeHueckel>;
+        PairForce<Tabulated>(savedSpec.cutoffSq).compute(pairs,
+            [&](Contact const& p) -> Tabulated const& {
+                return tables[p.q1_x_q2 > 0.0];
+            }, *state, dyn);
+    }
+    else {
+        auto coeff = pow(echarge, 2.0) / (4.0 * M_PI * permittivity);
 
-        auto x = sqrt(x2);
-        auto unit = r12/x;
+        PairForce<DebyeHueckel>(savedSpec.cutoffSq).compute(pairs,
+            [&](Contact const& p) -> DebyeHueckel {
+                return DebyeHueckel(coeff * p.q1_x_q2, screeningDist, false);
+            }, *state, dyn);
+    }
+}
 
-        auto V_DH = coeff * p.q1_x_q2 * exp(-x/screeningDist)/x;
-        dyn.V += V_DH;
+void ConstDH::fusedPairPart(vl::PairInfo const& pair, Dynamics &dyn) const {
+    auto q1_x_q2 = charge[pair.i1] * charge[pair.i2];
+    if (q1_x_q2 == 0) return;
 
-        auto dV_dx = -V_DH * (1.0 + x/screeningDist)/x;
-        dyn.F[p.i1] += dV_dx * unit;
-        dyn.F[p.i2] -= dV_dx * unit;
+    if (tabulated) {
+        tables[q1_x_q2 > 0].computeF(pair.unit, pair.norm, dyn.V,
+            dyn.F[pair.i1], dyn.F[pair.i2]);
+    }
+    else {
+        kernel(q1_x_q2).computeF(pair.unit, pair.norm, dyn.V,
+            dyn.F[pair.i1], dyn.F[pair.i2]);
     }
 }
@@ -4,6 +4,7 @@ using namespace mdk;
 
 void ESBase::bind(Simulation &simulation) {
     NonlocalForce::bind(simulation);
+    simulation.var<State>().useShadow();
 
     auto& model = simulation.data<Model>();
     auto& params = simulation.data<param::Parameters>();
@@ -24,17 +25,38 @@ void ESBase::bind(Simulation &simulation) {
         }
     }
 
+    /* The charges are looked up with the indices of the pairs of the list,
+     * so they follow the storage order of the residues.
+     */
+    simulation.var<State>().permuteHooks.emplace_back([&](Integers const& order) -> void {
+        reorder(charge, order);
+    });
+
     installIntoVL();
 }
 
+bool ESBase::fusible() const {
+    return true;
+}
+
 void ESBase::vlUpdateHook() {
-    pairs.clear();
-    for (auto const& [i1, i2]: vl->pairs) {
-        auto q1_x_q2 = charge[i1] * charge[i2];
-        if (q1_x_q2 != 0) {
-            pairs.emplace_back((Contact) {
-                .i1 = i1, .i2 = i2, .q1_x_q2 = (double)q1_x_q2
-            });
+    auto const& vlp = vlPairs();
+
+    std::vector<std::vector<Contact>> parts(vlp.numChunks());
+    vlp.forEachChunk([&](int chunk, int iBegin, int iEnd) -> void {
+        auto& part = parts[chunk];
+        for (int i1 = iBegin; i1 < iEnd; ++i1) {
+            for (int k = vlp.offsets[i1]; k < vlp.offsets[i1+1]; ++k) {
+                auto i2 = vlp.js[k];
+                auto q1_x_q2 = charge[i1] * charge[i2];
+                if (q1_x_q2 != 0) {
+                    part.emplace_back((Contact) {
+                        .i1 = i1, .i2 = i2, .q1_x_q2 = (double)q1_x_q2
+                    });
+                }
+            }
         }
-    }
+    });
+
+    vl::concatChunks(parts, pairs);
 }
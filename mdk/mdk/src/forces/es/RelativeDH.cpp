@@ -1,24 +1,17 @@
 #include "forces/es/RelativeDH.hpp"
+#include "forces/PairForce.hpp"
+#include "kernels/DebyeHueckel.hpp"
 using namespace mdk;
 
 void RelativeDH::asyncPart(Dynamics &dyn) {
-    auto coeff = pow(echarge, 2.0) / (4.0 * M_PI /  r0);
-
-    for (auto const& p: pairs) {
-        auto r12 = state->top(state->r[p.i1] - state->r[p.i2]);
-        auto x2 = r12.squaredNorm();
-        if (x2 > savedSpec.cutoffSq) continue;
+    if (fused) return;
 
-        auto x = sqrt(x2);
-        auto unit = r12/x;
-
-        auto V_DH = coeff * p.q1_x_q2 * exp(-x/screeningDist) / x;
-        dyn.V += V_DH;
+    auto coeff = pow(echarge, 2.0) / (4.0 * M_PI /  r0);
 
-        auto dV_dn = -V_DH * (2.0 + x/screeningDist)/x;
-        dyn.F[p.i1] += dV_dn * unit;
-        dyn.F[p.i2] -= dV_dn * unit;
-    }
+    PairForce<DebyeHueckel>(savedSpec.cutoffSq).compute(pairs,
+        [&](Contact const& p) -> DebyeHueckel {
+            return DebyeHueckel(coeff * p.q1_x_q2, screeningDist, true);
+        }, *state, dyn);
 }
 
 vl::Spec RelativeDH::spec() const {
@@ -27,3 +20,12 @@ vl::Spec RelativeDH::spec() const {
         .minBondSep = 3
     };
 }
+
+void RelativeDH::fusedPairPart(vl::PairInfo const& pair, Dynamics &dyn) const {
+    auto q1_x_q2 = charge[pair.i1] * charge[pair.i2];
+    if (q1_x_q2 == 0) return;
+
+    auto coeff = pow(echarge, 2.0) / (4.0 * M_PI /  r0);
+    auto dh = DebyeHueckel(coeff * q1_x_q2, screeningDist, true);
+    dh.computeF(pair.unit, pair.norm, dyn.V, dyn.F[pair.i1], dyn.F[pair.i2]);
+}
@@ -1,9 +1,11 @@
 #include "forces/go/NativeContacts.hpp"
+#include "forces/PairForce.hpp"
 #include "kernels/LennardJones.hpp"
 using namespace mdk;
 
 void NativeContacts::bind(Simulation &simulation) {
     NonlocalForce::bind(simulation);
+    simulation.var<State>().useShadow();
 
     auto& model = simulation.data<Model>();
     for (auto const& cont: model.contacts) {
@@ -31,15 +33,45 @@ void NativeContacts::bind(Simulation &simulation) {
                             return a.i1 == b.i1 && a.i2 == b.i2;
                         })));
 
+    Pairs exclusions;
+    for (auto const& cont: allContacts) {
+        exclusions.emplace_back(cont.i1, cont.i2);
+    }
+    vl->addExclusions(exclusions);
+
+    updateStoredContacts();
+    simulation.var<State>().permuteHooks.emplace_back([&](Integers const&) -> void {
+        updateStoredContacts();
+    });
+
     installIntoVL();
 }
 
+void NativeContacts::updateStoredContacts() {
+    auto const& sorted = state->sortedIdx;
+    storedContacts.clear();
+    for (auto const& cont: allContacts) {
+        auto i1 = sorted[cont.i1], i2 = sorted[cont.i2];
+        storedContacts.emplace_back((Contact) {
+            .i1 = std::min(i1, i2), .i2 = std::max(i1, i2),
+            .r_min = cont.r_min
+        });
+    }
+
+    sort(storedContacts.begin(), storedContacts.end(),
+         [](Contact const& a, Contact const& b) -> bool {
+             if (a.i1 == b.i1) return a.i2 < b.i2;
+             return a.i1 < b.i1;
+         });
+}
+
 vl::Spec NativeContacts::spec() const {
     double maxCutoff = 18.0 * angstrom;
 
     return (vl::Spec) {
         .cutoffSq = pow(maxCutoff, 2.0),
-        .minBondSep = 3
+        .minBondSep = 3,
+        .applyExclusions = false
     };
 }
 
@@ -52,38 +84,38 @@ bool operator==(NativeContacts::Contact const& p1, std::pair<int, int> const& p2
 }
 
 void NativeContacts::vlUpdateHook() {
-    curPairs.clear();
-    newVL.clear();
-
-    auto allContIter = allContacts.begin();
-    auto allContEnd = allContacts.end();
-
-    for (auto const& p: vl->pairs) {
-        while (allContIter != allContEnd && *allContIter < p)
-            ++allContIter;
-
-        if (allContIter != allContEnd && *allContIter == p) {
-            curPairs.emplace_back(*allContIter);
-        }
-        else {
-            newVL.emplace_back(p);
+    /* Both the native contacts and the sublist are ordered, so they are
+     * merged; each chunk of rows of the sublist starts the merge at the first
+     * native contact of the chunk. The native contacts are excluded from the
+     * sublists of the other forces by the Verlet list itself.
+     */
+    auto allContEnd = storedContacts.end();
+
+    auto const& vlp = vlPairs();
+    std::vector<std::vector<Contact>> parts(vlp.numChunks());
+    vlp.forEachChunk([&](int chunk, int iBegin, int iEnd) -> void {
+        auto allContIter = std::lower_bound(storedContacts.begin(), allContEnd,
+            iBegin, [](Contact const& cont, int i) -> bool {
+                return cont.i1 < i;
+            });
+        for (int i1 = iBegin; i1 < iEnd; ++i1) {
+            for (int k = vlp.offsets[i1]; k < vlp.offsets[i1+1]; ++k) {
+                auto p = std::make_pair(i1, vlp.js[k]);
+                while (allContIter != allContEnd && *allContIter < p)
+                    ++allContIter;
+
+                if (allContIter != allContEnd && *allContIter == p) {
+                    parts[chunk].emplace_back(*allContIter);
+                }
+            }
         }
-    }
-
-    std::swap(vl->pairs, newVL);
+    });
+    vl::concatChunks(parts, curPairs);
 }
 
 void NativeContacts::asyncPart(Dynamics &dyn) {
-    #pragma omp for nowait 
-    for (auto const& cont: curPairs) {
-        auto r12 = state->top(state->r[cont.i1] - state->r[cont.i2]);
-        auto x2 = r12.squaredNorm();
-        if (x2 > savedSpec.cutoffSq) continue;
-
-        auto x = sqrt(x2);
-        auto unit = r12/x;
-
-        auto lj = LennardJones(cont.r_min, depth);
-        lj.computeF(unit, x, dyn.V, dyn.F[cont.i1], dyn.F[cont.i2]);
-    }
+    PairForce<LennardJones>(savedSpec.cutoffSq).compute(curPairs,
+        [&](Contact const& cont) -> LennardJones {
+            return LennardJones(cont.r_min, depth);
+        }, *state, dyn);
 }
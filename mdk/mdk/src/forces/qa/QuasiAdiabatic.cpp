@@ -1,11 +1,14 @@
 #include "forces/qa/QuasiAdiabatic.hpp"
+#include "forces/PairForce.hpp"
 #include <Eigen/Core>
 #include <algorithm>
+#include <limits>
 using namespace mdk;
 using namespace mdk::param;
 
 void QuasiAdiabatic::bind(Simulation &simulation) {
     NonlocalForce::bind(simulation);
+    simulation.var<State>().useShadow();
 
     stats = &simulation.var<Stats>();
 
@@ -22,7 +25,7 @@ void QuasiAdiabatic::bind(Simulation &simulation) {
         ss_ljs[acid1][acid2] = ss_ljs[acid2][acid1] = sslj;
     }
 
-    n = h = Vectors(state->n);
+    geometry = &simulation.var<ChainGeometry>();
 
     formationMaxDistSq = 0.0;
     formationMaxDistSq = std::max(formationMaxDistSq, bb_lj.r_min);
@@ -39,60 +42,89 @@ void QuasiAdiabatic::bind(Simulation &simulation) {
 }
 
 void QuasiAdiabatic::asyncPart(Dynamics &dyn) {
-    computeNH();
-
-    for (auto& cont: pairs) {
-        if (cont.status == QAContact::Status::REMOVED)
-            continue;
-
-        double stage;
-        if (cont.status == QAContact::Status::FORMING) {
-            stage = std::min((state->t - cont.t0) / formationTime, 1.0);
-        }
-        else {
-            stage = std::max(1.0 - (state->t - cont.t0) / breakingTime, 0.0);
-        }
-
-        Vector r = state->top(state->r[cont.i2] - state->r[cont.i1]);
-        auto norm = r.norm();
-        auto unit = r / norm;
-        double r_min;
-
-        if (stage > 0.0) {
+    using Engine = PairForce<ContactKernel>;
+    constexpr int batchSize = Engine::batchSize;
+
+    auto const& sorted = state->sortedIdx;
+    auto engine = Engine(std::numeric_limits<double>::infinity());
+    int numBlocks = ((int)pairs.size() + batchSize - 1) / batchSize;
+
+    /* The contacts are taken in blocks of batchSize; the ones which exert
+     * a force (at a nonzero stage) are gathered into a batch, and the ones
+     * which broke are removed afterwards, given their distances.
+     */
+    #pragma omp for nowait
+    for (int block = 0; block < numBlocks; ++block) {
+        int first = block * batchSize;
+        int last = std::min(first + batchSize, (int)pairs.size());
+
+        int count = 0, idxs[batchSize], i1[batchSize], i2[batchSize];
+        ContactKernel kernels[batchSize];
+        double norms[batchSize];
+
+        for (int idx = first; idx < last; ++idx) {
+            auto const& cont = pairs[idx];
+            if (cont.status == QAContact::Status::REMOVED || stage(cont) <= 0.0)
+                continue;
+
+            auto& kernel = kernels[count];
             if (cont.type == Stats::Type::BB) {
-                bb_lj.computeF(unit, norm, dyn.V, dyn.F[cont.i1],
-                    dyn.F[cont.i2]);
-                r_min = bb_lj.r_min;
+                kernel.lj = bb_lj;
             }
             else if (cont.type != Stats::Type::SS) {
-                bs_lj.computeF(unit, norm, dyn.V, dyn.F[cont.i1],
-                    dyn.F[cont.i2]);
-                r_min = bs_lj.r_min;
+                kernel.lj = bs_lj;
             }
             else {
                 auto const& ss_lj = ss_ljs[(*types)[cont.i1]][(*types)[cont.i2]];
-                ss_lj.computeF(unit, norm, dyn.V, dyn.F[cont.i1], dyn.F[cont.i2]);
-                r_min = ss_lj.sink_max;
+                kernel.lj = LennardJones(ss_lj.sink_max, ss_lj.depth);
+                kernel.sinkMax = ss_lj.sink_max;
             }
 
+            idxs[count] = idx;
+            i1[count] = sorted[cont.i1];
+            i2[count] = sorted[cont.i2];
+            ++count;
+        }
+
+        if (count > 0) {
+            engine.computeBatch(count, i1, i2, *state, dyn,
+                [&](int b) -> ContactKernel const& {
+                    return kernels[b];
+                }, norms);
+        }
+
+        for (int b = 0; b < count; ++b) {
+            auto& cont = pairs[idxs[b]];
             if (cont.status == QAContact::Status::FORMING &&
-                norm > breakingTolerance * pow(2.0, -1.0/6.0) * r_min) {
+                norms[b] > breakingTolerance * pow(2.0, -1.0/6.0) *
+                    kernels[b].lj.r_min) {
 
                 cont.status = QAContact::Status::BREAKING;
                 cont.t0 = state->t;
             }
         }
 
-        if (cont.status == QAContact::Status::BREAKING && stage == 0.0) {
-            cont.status = QAContact::Status::REMOVED;
-            freePairs.emplace_back((QAFreePair) {
-                .i1 = cont.i1, .i2 = cont.i2,
-                .status = QAFreePair::Status::FREE
-            });
+        for (int idx = first; idx < last; ++idx) {
+            auto& cont = pairs[idx];
+            if (cont.status == QAContact::Status::BREAKING &&
+                stage(cont) == 0.0) {
+
+                cont.status = QAContact::Status::REMOVED;
+                removedIdxMutex.lock();
+                removedIdx.push_back(idx);
+                removedIdxMutex.unlock();
+            }
         }
     }
 }
 
+double QuasiAdiabatic::stage(QAContact const& cont) const {
+    if (cont.status == QAContact::Status::FORMING)
+        return std::min((state->t - cont.t0) / formationTime, 1.0);
+    else
+        return std::max(1.0 - (state->t - cont.t0) / breakingTime, 0.0);
+}
+
 vl::Spec QuasiAdiabatic::spec() const {
     double maxCutoff = 0.0;
     maxCutoff = std::max(maxCutoff, bb_lj.cutoff());
@@ -122,35 +154,90 @@ void QuasiAdiabatic::vlUpdateHook() {
     std::swap(oldPairs, pairs);
     freePairs.clear();
 
-    auto oldPairsIter = oldPairs.begin();
-    auto oldPairsEnd = oldPairs.end();
-
-    for (auto& pair : vl->pairs) {
-        if (chains->isTerminal[pair.first] || chains->isTerminal[pair.second]
-            || !chains->sepByAtLeastN(pair.first, pair.second, 3)) {
-
-            continue;
-        }
-
-        while (oldPairsIter != oldPairsEnd && *oldPairsIter < pair)
-            ++oldPairsIter;
-
-        if (oldPairsIter != oldPairsEnd
-            && oldPairsIter->status != QAContact::Status::REMOVED
-            && *oldPairsIter == pair) {
-
-            pairs.emplace_back(*oldPairsIter);
-        }
-        else {
-            freePairs.emplace_back((QAFreePair) {
-                .i1 = pair.first, .i2 = pair.second,
-                .status = QAFreePair::Status::FREE
+    /* The contacts formed since the last update were appended at the end of
+     * the list, so we need to sort it before merging it with the new list.
+     */
+    std::sort(oldPairs.begin(), oldPairs.end(),
+        [](QAContact const& p1, QAContact const& p2) -> bool {
+            return std::make_pair(p1.i1, p1.i2) < std::make_pair(p2.i1, p2.i2);
+        });
+
+    /* The merge is done separately for each chunk of rows of the list, each
+     * starting at the first old contact of the chunk. The contacts are kept
+     * with the original indices of the residues, so if the residues are
+     * stored in a different order (see \p State::permute), the pairs of the
+     * list don't come in the order of the contacts, and each one is looked up
+     * with a binary search instead.
+     */
+    auto const& vlp = vlPairs();
+    auto const& orig = state->origIdx;
+    auto permuted = state->permuted;
+    std::vector<std::vector<QAContact>> pairsParts(vlp.numChunks());
+    std::vector<std::vector<QAFreePair>> freePairsParts(vlp.numChunks());
+
+    vlp.forEachChunk([&](int chunk, int iBegin, int iEnd) -> void {
+        auto oldPairsIter = std::lower_bound(oldPairs.begin(), oldPairs.end(),
+            iBegin, [](QAContact const& p, int i) -> bool {
+                return p.i1 < i;
             });
+        auto oldPairsEnd = oldPairs.end();
+
+        for (int k1 = iBegin; k1 < iEnd; ++k1) {
+            for (int k = vlp.offsets[k1]; k < vlp.offsets[k1+1]; ++k) {
+                auto k2 = vlp.js[k];
+                auto i1 = std::min(orig[k1], orig[k2]),
+                    i2 = std::max(orig[k1], orig[k2]);
+                if (chains->isTerminal[i1] || chains->isTerminal[i2]
+                    || !chains->sepByAtLeastN(i1, i2, 3)) {
+
+                    continue;
+                }
+
+                auto pair = std::make_pair(i1, i2);
+                if (permuted) {
+                    oldPairsIter = std::lower_bound(oldPairs.begin(),
+                        oldPairsEnd, pair,
+                        [](QAContact const& p, std::pair<int, int> const& q)
+                            -> bool { return p < q; });
+                }
+                while (oldPairsIter != oldPairsEnd && *oldPairsIter < pair)
+                    ++oldPairsIter;
+
+                if (oldPairsIter != oldPairsEnd
+                    && oldPairsIter->status != QAContact::Status::REMOVED
+                    && *oldPairsIter == pair) {
+
+                    pairsParts[chunk].emplace_back(*oldPairsIter);
+                }
+                else {
+                    freePairsParts[chunk].emplace_back((QAFreePair) {
+                        .i1 = i1, .i2 = i2,
+                        .status = QAFreePair::Status::FREE
+                    });
+                }
+            }
         }
+    });
+
+    vl::concatChunks(pairsParts, pairs);
+    vl::concatChunks(freePairsParts, freePairs);
+
+    /* The free pairs compete for the residues in the order of the list (see
+     * \p syncPart), which is to be the same as for the original order.
+     */
+    if (permuted) {
+        std::sort(freePairs.begin(), freePairs.end(),
+            [](QAFreePair const& p1, QAFreePair const& p2) -> bool {
+                return std::make_pair(p1.i1, p1.i2) <
+                    std::make_pair(p2.i1, p2.i2);
+            });
     }
 }
 
 bool QuasiAdiabatic::geometryPhase(vl::PairInfo const& p, QADiff &diff) const {
+    auto const& h = geometry->h;
+    auto const& n = geometry->n;
+
     Vector h1 = h[p.i1], h2 = h[p.i2];
     double cos_h1_r12 = h1.dot(p.unit), cos_h2_r12 = h2.dot(p.unit),
         cos_h1_h2 = h1.dot(h2);
@@ -191,6 +278,15 @@ bool QuasiAdiabatic::geometryPhase(vl::PairInfo const& p, QADiff &diff) const {
 }
 
 void QuasiAdiabatic::syncPart(Dynamics &dyn) {
+    std::sort(removedIdx.begin(), removedIdx.end());
+    for (auto idx: removedIdx) {
+        freePairs.emplace_back((QAFreePair) {
+            .i1 = pairs[idx].i1, .i2 = pairs[idx].i2,
+            .status = QAFreePair::Status::FREE
+        });
+    }
+    removedIdx.clear();
+
     qaDiffs.clear();
     for (int i = 0; i < (int)freePairs.size(); ++i) {
         auto const& p = freePairs[i];
@@ -202,7 +298,8 @@ void QuasiAdiabatic::syncPart(Dynamics &dyn) {
         pairInfo.i1 = p.i1;
         pairInfo.i2 = p.i2;
 
-        auto r = state->top(state->r[p.i1] - state->r[p.i2]);
+        auto const& sorted = state->sortedIdx;
+        auto r = state->top(state->r[sorted[p.i1]] - state->r[sorted[p.i2]]);
         auto r_normsq = r.squaredNorm();
         if (r_normsq >= formationMaxDistSq)
             continue;
@@ -249,14 +346,3 @@ void QuasiAdiabatic::syncPart(Dynamics &dyn) {
         pairs.push_back(diff.cont);
     }
 }
-
-void QuasiAdiabatic::computeNH() {
-    for (int i = 0; i < (int)chains->triples.size(); ++i) {
-        if (!chains->triples[i]) continue;
-
-        auto r0 = state->r[i-1], r1 = state->r[i], r2 = state->r[i+1];
-        auto v0 = r1 - r0, v1 = r2 - r1;
-        n[i] = (v1 - v0).normalized();
-        h[i] = (v1.cross(v0)).normalized();
-    }
-}
@@ -6,6 +6,7 @@ void SolidWall::asyncPart(Dynamics &dynamics) {
     static constexpr double r0_inv = 1.0 / r0;
     static constexpr double r0_sq = r0 * r0;
 
+    #pragma omp for nowait
     for (int i = 0; i < state->n; ++i) {
         Vector v = state->r[i] - wall.projection(state->r[i]);
         auto x2 = v.squaredNorm() / r0_sq;
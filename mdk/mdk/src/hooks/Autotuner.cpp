@@ -0,0 +1,255 @@
+#include "hooks/Autotuner.hpp"
+#include "simul/Simulation.hpp"
+#include <omp.h>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <limits>
+using namespace mdk;
+using namespace std;
+using namespace std::chrono;
+
+Autotuner::Autotuner(std::string profilePath):
+    profilePath(std::move(profilePath)) {}
+
+void Autotuner::bind(Simulation &simulation) {
+    vl = &simulation.var<vl::List>();
+    state = &simulation.var<State>();
+
+    if (loadProfile()) {
+        apply(best);
+        stage = Stage::FINISHED;
+
+        if (verbose) {
+            cout << "Autotuner: loaded " << describe(best) << " from "
+                 << profilePath << endl;
+        }
+    }
+}
+
+bool Autotuner::finished() const {
+    return stage == Stage::FINISHED;
+}
+
+void Autotuner::execute(int step_nr) {
+    if (stage == Stage::FINISHED) return;
+
+    ++steps;
+    if (stage == Stage::WARMUP) {
+        if (steps >= warmupSteps) {
+            best = (Config) {
+                .pad = vl->pad,
+                .algorithm = vl->algorithm,
+                .threads = omp_get_max_threads()
+            };
+            nextStage();
+        }
+        return;
+    }
+
+    if (steps < trialSteps) return;
+
+    auto cost = finishTrial();
+    if (cost < bestCost) {
+        best = candidates[candidateIdx];
+        bestCost = cost;
+    }
+
+    if (++candidateIdx < (int)candidates.size()) startTrial();
+    else nextStage();
+}
+
+void Autotuner::apply(Config const& config) {
+    vl->pad = config.pad;
+    vl->algorithm = config.algorithm;
+    omp_set_num_threads(config.threads);
+}
+
+void Autotuner::startTrial() {
+    /* Each trial begins with the reconstruction of the list, so that it's
+     * built with the configuration being tried out.
+     */
+    apply(candidates[candidateIdx]);
+    vl->invalidate();
+
+    steps = 0;
+    trialStart = steady_clock::now();
+    updates0 = vl->numUpdates;
+    updateTime0 = vl->updateTime;
+}
+
+double Autotuner::finishTrial() {
+    auto total = duration<double>(steady_clock::now() - trialStart).count();
+    auto updates = vl->numUpdates - updates0;
+    auto updateTime = vl->updateTime - updateTime0;
+
+    auto stepCost = (total - updateTime) / steps;
+    auto updateCost = updates > 0 ? updateTime / updates : 0.0;
+
+    /* The first update is the forced one, at the beginning of the trial;
+     * each of the following ones means that the whole padding has been
+     * used up, and the current list has used up a fraction of it. This
+     * gives the rate at which the padding is used up, and thus the average
+     * number of steps between the updates, which may well exceed the
+     * length of the trial.
+     */
+    auto budget = std::max((updates - 1) + vl->budgetUsed(), 0.0);
+    auto cost = stepCost + updateCost * budget / steps;
+
+    if (verbose) {
+        cout << "Autotuner: " << describe(candidates[candidateIdx]) << ": "
+             << cost * 1e3 << " ms/step (step " << stepCost * 1e3
+             << " ms, update " << updateCost * 1e3 << " ms every "
+             << (budget > 0.0 ? steps / budget :
+                 std::numeric_limits<double>::infinity())
+             << " steps)" << endl;
+    }
+
+    return cost;
+}
+
+void Autotuner::nextStage() {
+    while (true) {
+        candidates.clear();
+
+        if (stage == Stage::WARMUP) {
+            stage = Stage::THREADS;
+
+            auto counts = threadCounts;
+            if (counts.empty()) {
+                auto numProcs = omp_get_num_procs();
+                for (int threads = 1; threads < numProcs; threads *= 2)
+                    counts.push_back(threads);
+                counts.push_back(numProcs);
+            }
+
+            for (auto threads: counts) {
+                auto config = best;
+                config.threads = threads;
+                candidates.push_back(config);
+            }
+        }
+        else if (stage == Stage::THREADS) {
+            stage = Stage::ALGORITHM;
+
+            for (auto algorithm: { vl::List::Algorithm::ALL_PAIRS,
+                                   vl::List::Algorithm::CELL }) {
+                auto config = best;
+                config.algorithm = algorithm;
+                candidates.push_back(config);
+            }
+        }
+        else if (stage == Stage::ALGORITHM) {
+            stage = Stage::PAD;
+
+            for (auto pad: pads) {
+                auto config = best;
+                config.pad = pad;
+                candidates.push_back(config);
+            }
+        }
+        else {
+            finish();
+            return;
+        }
+
+        if (candidates.size() >= 2) {
+            candidateIdx = 0;
+            bestCost = std::numeric_limits<double>::infinity();
+            startTrial();
+            return;
+        }
+        else if (candidates.size() == 1) {
+            best = candidates[0];
+        }
+    }
+}
+
+void Autotuner::finish() {
+    stage = Stage::FINISHED;
+    apply(best);
+    vl->invalidate();
+
+    if (verbose)
+        cout << "Autotuner: chose " << describe(best) << endl;
+
+    if (!profilePath.empty())
+        saveProfile();
+}
+
+static std::string algorithmName(vl::List::Algorithm algorithm) {
+    switch (algorithm) {
+    case vl::List::Algorithm::ALL_PAIRS:
+        return "all-pairs";
+    case vl::List::Algorithm::CELL:
+        return "cell";
+    default:
+        return "auto";
+    }
+}
+
+std::string Autotuner::describe(Config const& config) const {
+    stringstream ss;
+    ss << "threads = " << config.threads
+       << ", algorithm = " << algorithmName(config.algorithm)
+       << ", pad = " << config.pad / angstrom << " A";
+    return ss.str();
+}
+
+bool Autotuner::loadProfile() {
+    if (profilePath.empty()) return false;
+
+    ifstream file(profilePath);
+    if (!file) return false;
+
+    /* The profile consists of lines "key value"; it's only used if it was
+     * created for a system of the same size.
+     */
+    int n = -1;
+    Config config = {
+        .pad = vl->pad,
+        .algorithm = vl->algorithm,
+        .threads = omp_get_max_threads()
+    };
+
+    string key;
+    while (file >> key) {
+        if (key == "residues") {
+            file >> n;
+        }
+        else if (key == "pad") {
+            double pad;
+            file >> pad;
+            config.pad = pad * angstrom;
+        }
+        else if (key == "algorithm") {
+            string name;
+            file >> name;
+            if (name == algorithmName(vl::List::Algorithm::ALL_PAIRS))
+                config.algorithm = vl::List::Algorithm::ALL_PAIRS;
+            else if (name == algorithmName(vl::List::Algorithm::CELL))
+                config.algorithm = vl::List::Algorithm::CELL;
+            else
+                config.algorithm = vl::List::Algorithm::AUTO;
+        }
+        else if (key == "threads") {
+            file >> config.threads;
+        }
+        else {
+            getline(file, key);
+        }
+    }
+
+    if (n != state->n) return false;
+
+    best = config;
+    return true;
+}
+
+void Autotuner::saveProfile() const {
+    ofstream file(profilePath);
+    file << "residues " << state->n << '\n'
+         << "pad " << best.pad / angstrom << '\n'
+         << "algorithm " << algorithmName(best.algorithm) << '\n'
+         << "threads " << best.threads << '\n';
+}
@@ -30,7 +30,11 @@ void PositionDiff::bind(Simulation& simulation) {
 void PositionDiff::execute(int step_nr) {
     auto it = refPositions.find(step_nr);
     if (it != refPositions.end()) {
-        VectorBase diffs = (it -> second) - (state -> r / angstrom);
+        Vectors r(state->n);
+        for (int i = 0; i < state->n; ++i)
+            r[i] = state->r[state->sortedIdx[i]];
+
+        VectorBase diffs = (it -> second) - (r / angstrom);
         Scalars diff_lengths = diffs.colwise().norm();
         double max_diff_len = diff_lengths.maxCoeff();
         double mean_diff_len = diff_lengths.mean();
@@ -38,8 +42,20 @@ void PositionDiff::execute(int step_nr) {
         output << "Step #" << setw(8) << step_nr
                << ": max " << setw(12) << max_diff_len
                << ": mean " << setw(12) << mean_diff_len << endl;
+
+        driftMax = max(driftMax, max_diff_len);
+        driftMeanSum += mean_diff_len;
+        ++numCompared;
     }
     else {
         output << "No information about positions in step " << step_nr << endl;
     }
 }
+
+void PositionDiff::reportDrift() {
+    if (numCompared == 0) return;
+
+    output << "Drift over " << numCompared << " steps"
+           << ": max " << setw(12) << driftMax
+           << ": mean " << setw(12) << driftMeanSum / numCompared << endl;
+}
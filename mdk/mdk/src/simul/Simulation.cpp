@@ -3,6 +3,7 @@
 #include "forces/NonlocalForce.hpp"
 #include "hooks/Hook.hpp"
 #include "system/Integrator.hpp"
+#include "system/ChainGeometry.hpp"
 using namespace mdk;
 
 extern Dynamics thread_dyn;
@@ -17,14 +18,16 @@ void Simulation::calcForces() {
     {
         thread_dyn.zero(state -> n);
 
+        if (geometry) {
+            geometry -> update();
+        }
+
         #pragma omp master
         for (auto const& task : asyncTasks) {
             task();
         }
             
-        for (auto* force: forces) {
-            force->asyncPart(thread_dyn);
-        }
+        asyncForces(thread_dyn);
 
         #pragma omp critical
         {
@@ -32,8 +35,30 @@ void Simulation::calcForces() {
         }
     }
 
+    syncForces(state -> dyn);
+}
+
+void Simulation::compose() {}
+
+void Simulation::asyncForces(Dynamics &dyn) {
     for (auto* force: forces) {
-        force->syncPart(state -> dyn);
+        force->asyncPart(dyn);
+    }
+}
+
+void Simulation::syncForces(Dynamics &dyn) {
+    for (auto* force: forces) {
+        force->syncPart(dyn);
+    }
+}
+
+void Simulation::integrate() {
+    integrator->integrate();
+}
+
+void Simulation::runHooks(int step_nr) {
+    for (auto* hook: hooks) {
+        hook->execute(step_nr);
     }
 }
 
@@ -43,12 +68,11 @@ void Simulation::init() {
     
     step_nr = 0;
 
+    compose();
     calcForces();
     integrator->init();
 
-    for (auto* hook: hooks) {
-        hook->execute(0);
-    }
+    runHooks(0);
     
     initialized = true;
 }
@@ -61,11 +85,8 @@ void Simulation::step() {
     step_nr++;
 
     calcForces();
-    integrator->integrate();
-
-    for (auto* hook: hooks) {
-        hook->execute(step_nr);
-    }
+    integrate();
+    runHooks(step_nr);
 }
 
 void Simulation::step(double t) {
@@ -0,0 +1,35 @@
+#include "system/ChainGeometry.hpp"
+#include "simul/Simulation.hpp"
+#include "data/Chains.hpp"
+using namespace mdk;
+
+void ChainGeometry::bind(Simulation &simulation) {
+    state = &simulation.var<State>();
+    triples = simulation.data<Chains>().triples;
+
+    auto n_res = state->n;
+    bond = bondCross = Vectors(n_res, Vector::Zero());
+    n = h = Vectors(n_res, Vector::Zero());
+    bondNorm = Scalars::Zero(n_res);
+}
+
+void ChainGeometry::update() {
+    auto const& r = state->r;
+    auto const& idx = state->sortedIdx;
+
+    #pragma omp for
+    for (int i = 0; i < state->n - 1; ++i) {
+        bond[i] = r[idx[i+1]] - r[idx[i]];
+        bondNorm[i] = bond[i].norm();
+    }
+
+    #pragma omp for
+    for (int i = 0; i < (int)triples.size(); ++i) {
+        if (!triples[i]) continue;
+
+        auto v0 = bond[i-1], v1 = bond[i];
+        bondCross[i] = v0.cross(v1);
+        n[i] = (v1 - v0).normalized();
+        h[i] = (-bondCross[i]).normalized();
+    }
+}
@@ -12,11 +12,16 @@ void LangPredictorCorrector::init() {
 
 void LangPredictorCorrector::generateNoise() {
     if (initialized) {
+        /* The noise is drawn in the original order of the residues and
+         * stored at their storage indices, so that the trajectory for a given
+         * seed doesn't depend on the storage order. */
+        auto const& idx = state->sortedIdx;
+
         #ifdef LEGACY_MODE
             #pragma omp task
             for (int dim = 0; dim < 3; ++dim) {
                 for (int i = 0; i < state->n; ++i) {
-                    gaussianNoise[i](dim) = random -> normal();
+                    gaussianNoise[idx[i]](dim) = random -> normal();
                 }
             }
         #else
@@ -25,11 +30,11 @@ void LangPredictorCorrector::generateNoise() {
                 {
                     for (int i = 0; i + 1 < state->n; i += 2) {
                         std::pair<double, double> normals = rngs[dim].two_normals();
-                        gaussianNoise[i](dim) = normals.first;
-                        gaussianNoise[i + 1](dim) = normals.first;
+                        gaussianNoise[idx[i]](dim) = normals.first;
+                        gaussianNoise[idx[i + 1]](dim) = normals.first;
                     }
                     if (state->n % 2) {
-                        gaussianNoise[state->n-1](dim) = rngs[dim].normal();
+                        gaussianNoise[idx[state->n-1]](dim) = rngs[dim].normal();
                     }
                 }
             }
@@ -87,6 +92,17 @@ void LangPredictorCorrector::bind(Simulation &simulation) {
     }
 
     gaussianNoise = Vectors(model.n);
+
+    /* The noise is generated anew for each step (and stored in the current
+     * order), so only the state of the integrator and the masses follow the
+     * order of the residues.
+     */
+    state->permuteHooks.emplace_back([&](Integers const& order) -> void {
+        reorder(m, order);
+        for (auto* y: { &y0, &y1, &y2, &y3, &y4, &y5 })
+            reorder(*y, order);
+    });
+
     simulation.addAsyncTask([this]() { this->generateNoise(); });
 
     #ifndef LEGACY_MODE
@@ -20,4 +20,9 @@ void Leapfrog::bind(Simulation &simulation) {
     Integrator::bind(simulation);
     m = simulation.data<Masses>();
     a_prev = Vectors(m.size(), Vector::Zero());
+
+    state->permuteHooks.emplace_back([&](Integers const& order) -> void {
+        reorder(m, order);
+        reorder(a_prev, order);
+    });
 }
@@ -5,8 +5,8 @@ using namespace mdk;
 void State::exportTo(Model &model) const {
     for (int i = 0; i < model.n; ++i) {
         auto& res = model.residues[i];
-        res.r = r[i];
-        res.v = v[i];
+        res.r = r[sortedIdx[i]];
+        res.v = v[sortedIdx[i]];
     }
 }
 
@@ -19,6 +19,11 @@ void State::bind(Simulation &simul) {
     top = model.top;
     dyn.F = Vectors(n);
 
+    sortedIdx = origIdx = Integers(n);
+    for (int i = 0; i < n; ++i) {
+        sortedIdx[i] = origIdx[i] = i;
+    }
+
     for (int i = 0; i < model.n; ++i) {
         auto& res = model.residues[i];
         r[i] = res.r;
@@ -26,8 +31,37 @@ void State::bind(Simulation &simul) {
     }
 }
 
+void State::permute(Integers const& order) {
+    reorder(r, order);
+    reorder(v, order);
+    reorder(dyn.F, order);
+#ifdef MIXED_PRECISION
+    if (shadowUsed) rShadow = r.cast<Real>();
+#endif
+
+    reorder(origIdx, order);
+    permuted = false;
+    for (int k = 0; k < n; ++k) {
+        sortedIdx[origIdx[k]] = k;
+        permuted = permuted || origIdx[k] != k;
+    }
+
+    for (auto const& hook: permuteHooks) {
+        hook(order);
+    }
+}
+
 void State::prepareDyn() {
     dyn.zero(n);
+#ifdef MIXED_PRECISION
+    if (shadowUsed) rShadow = r.cast<Real>();
+#endif
+}
+
+void State::useShadow() {
+#ifdef MIXED_PRECISION
+    shadowUsed = true;
+#endif
 }
 
 void State::updateWithDyn(Dynamics const& othDyn) {
@@ -0,0 +1,355 @@
+#include "verlet/CellGrid.hpp"
+#include <omp.h>
+#include <algorithm>
+using namespace mdk;
+using namespace mdk::vl;
+
+extern Eigen::AlignedBox3d bboxTP;
+
+#pragma omp threadprivate(bboxTP)
+
+Eigen::AlignedBox3d bboxTP;
+
+int CellGrid::neighbourCells(int c1, int* neighbours) const {
+    auto loc1 = locOf(c1);
+
+    /* All the neighbours of a cell are obtained by going through the
+     * offsets of the (half-shell) stencil in both directions; the offsets
+     * which are their own opposites are only taken once.
+     */
+    int numNeighbours = 0;
+    for (auto const& entry: stencil) {
+        for (int sign = 1; sign >= -1; sign -= 2) {
+            if (sign < 0 && (entry.offset.isZero() || entry.selfInverse))
+                continue;
+
+            Eigen::Vector3i loc2 = loc1 + sign * entry.offset;
+
+            bool inGrid = true;
+            for (int dim = 0; dim < 3; ++dim) {
+                if (top->use[dim]) {
+                    loc2[dim] = (loc2[dim] % grid[dim] + grid[dim]) % grid[dim];
+                }
+                else if (loc2[dim] < 0 || loc2[dim] >= grid[dim]) {
+                    inGrid = false;
+                }
+            }
+
+            if (!inGrid) continue;
+
+            auto c2 = cellAt(loc2);
+            if (c2 >= 0) neighbours[numNeighbours++] = c2;
+        }
+    }
+
+    return numNeighbours;
+}
+
+void CellGrid::setupStencil() {
+    /* We bring each of the 27 offsets into a canonical form: along the
+     * periodic axes, modulo the size of the grid (so that, for example, with
+     * two cells the offsets -1 and 1 coincide, and with a single cell all of
+     * them are equal to 0), and along the other ones we drop the offsets
+     * which cannot lead to a cell inside the grid. Distinct canonical offsets
+     * then lead to distinct neighbours of a given cell.
+     */
+    auto canonical = [&](Eigen::Vector3i d, bool& valid) -> Eigen::Vector3i {
+        valid = true;
+        for (int dim = 0; dim < 3; ++dim) {
+            if (top->use[dim]) {
+                d[dim] = ((d[dim] % grid[dim]) + grid[dim]) % grid[dim];
+            }
+            else if (abs(d[dim]) >= grid[dim]) {
+                valid = false;
+            }
+        }
+        return d;
+    };
+
+    auto less = [](Eigen::Vector3i const& u, Eigen::Vector3i const& v) -> bool {
+        return std::lexicographical_compare(u.data(), u.data() + 3,
+            v.data(), v.data() + 3);
+    };
+
+    std::vector<Eigen::Vector3i> offsets;
+    Eigen::Vector3i d;
+    for (d.x() = -1; d.x() <= 1; ++d.x()) {
+        for (d.y() = -1; d.y() <= 1; ++d.y()) {
+            for (d.z() = -1; d.z() <= 1; ++d.z()) {
+                bool valid;
+                auto offset = canonical(d, valid);
+                if (valid) offsets.push_back(offset);
+            }
+        }
+    }
+
+    std::sort(offsets.begin(), offsets.end(), less);
+    offsets.erase(std::unique(offsets.begin(), offsets.end()), offsets.end());
+
+    /* Out of every pair of opposite offsets d and -d we keep only one, as
+     * going from c1 to c1 + d visits the same pair of cells as going from
+     * c1 + d to c1. An offset may be its own opposite (for example along
+     * the periodic axes with two cells), in which case we keep it but mark
+     * it as such, so that the pair of cells is only visited from the one
+     * with a lower index. The zero offset stands for the cell itself.
+     */
+    stencil.clear();
+    for (auto const& offset: offsets) {
+        bool valid;
+        auto opposite = canonical(-offset, valid);
+        if (less(opposite, offset)) continue;
+
+        StencilEntry entry;
+        entry.offset = offset;
+        entry.selfInverse = !offset.isZero() && opposite == offset;
+        stencil.push_back(entry);
+    }
+}
+
+void CellGrid::setup(double minCellSize) {
+    /* We compute the integral size of the grid, and consequently adjust the
+     * cell sizes. They will be slightly larger than \p minCellSize. This is
+     * done in order to have the box divided into an integral number of cells
+     * along each axis, as otherwise some would intuitively "stick out" which
+     * would be troublesome for computing neighbors with PBC. Along periodic
+     * axes, the box in question is the simulation box, so that the cells
+     * at the opposite sides are indeed neighbours.
+     */
+    Eigen::Vector3d extent;
+    for (int dim = 0; dim < 3; ++dim) {
+        if (top->use[dim]) {
+            extent[dim] = top->cell[dim];
+            origin[dim] = -0.5 * extent[dim];
+        }
+        else {
+            extent[dim] = bbox.sizes()[dim];
+            origin[dim] = bbox.min()[dim];
+        }
+
+        grid[dim] = std::max((int)std::floor(extent[dim] / minCellSize), 1);
+    }
+
+    /* If the residues are scattered over a large volume, the number of
+     * (mostly empty) cells could be arbitrarily large. Rather than enlarging
+     * the cells, which for a dilute system with dense aggregates would put
+     * the aggregates into a few huge cells and make the cost quadratic in
+     * their sizes, we then switch to the sparse grid, in which only the
+     * occupied cells are stored (see \p findOccupiedCells). The size of the
+     * grid along an axis is only capped so that the keys of the cells fit
+     * in 64 bits; this enlarges the cells, which doesn't affect the
+     * correctness, as they are only required to be no smaller than
+     * \p minCellSize.
+     */
+    for (int dim = 0; dim < 3; ++dim) {
+        grid[dim] = std::min(grid[dim], maxGridSize);
+    }
+
+    double maxCells = maxCellsPerResidue * std::max(n, 1);
+    double denseCells = (double)grid.x() * grid.y() * grid.z();
+    sparse = denseCells > maxCells;
+    numCells = sparse ? 0 : (int)denseCells;
+
+    for (int dim = 0; dim < 3; ++dim) {
+        cellSize[dim] = extent[dim] / grid[dim];
+    }
+
+    setupStencil();
+}
+
+Eigen::Vector3i CellGrid::locate(Vector const& pos) const {
+    auto v = (*top)(pos);
+
+    Eigen::Vector3i loc = {
+        (int)std::floor((v.x() - origin.x()) / cellSize.x()),
+        (int)std::floor((v.y() - origin.y()) / cellSize.y()),
+        (int)std::floor((v.z() - origin.z()) / cellSize.z()),
+    };
+
+    /* This is for the edge cases, and for the residues which have left the
+     * grid along the non-periodic axes since it was computed; clamping the
+     * location doesn't increase the distances between the cells, so the
+     * neighbouring residues still end up in the neighbouring cells.
+     */
+    for (int dim = 0; dim < 3; ++dim) {
+        if (loc[dim] >= grid[dim])
+            loc[dim] = grid[dim]-1;
+
+        if (loc[dim] < 0)
+            loc[dim] = 0;
+    }
+
+    return loc;
+}
+
+void CellGrid::findOccupiedCells(Bytes const* isMoved, Integers const* moved) {
+#pragma omp single
+    residueKeys.resize(n);
+
+#pragma omp for schedule(static)
+    for (int i = 0; i < n; ++i) {
+        if (!isMoved || (*isMoved)[i])
+            residueKeys[i] = keyOf(locate((*r)[i]));
+    }
+
+#pragma omp single
+    {
+        /* The occupied cells are numbered in the order of their keys. When
+         * only some of the residues have moved, the cells they have moved
+         * to are added to the existing ones; the cells they have left may
+         * remain in the grid, empty, until it's rebuilt.
+         */
+        if (!isMoved) {
+            cellKeys = residueKeys;
+        }
+        else {
+            for (auto i: *moved) {
+                cellKeys.push_back(residueKeys[i]);
+            }
+        }
+
+        std::sort(cellKeys.begin(), cellKeys.end());
+        cellKeys.erase(std::unique(cellKeys.begin(), cellKeys.end()),
+            cellKeys.end());
+        numCells = (int)cellKeys.size();
+
+        /* The cells are then placed into an open-addressing hash table
+         * (with linear probing and the load factor of at most 1/2), so that
+         * a cell can be found by its key in (expected) constant time.
+         */
+        int numSlots = 2;
+        while (numSlots < 2 * numCells) numSlots *= 2;
+        slotMask = numSlots - 1;
+        slotCells.assign(numSlots, -1);
+
+        cellLocs.resize(numCells);
+        for (int c = 0; c < numCells; ++c) {
+            auto key = cellKeys[c];
+            cellLocs[c] = {
+                (int)(key % grid.x()),
+                (int)((key / grid.x()) % grid.y()),
+                (int)((key / grid.x()) / grid.y())
+            };
+
+            auto slot = slotOf(key);
+            while (slotCells[slot] >= 0) slot = (slot + 1) & slotMask;
+            slotCells[slot] = c;
+        }
+    }
+}
+
+void CellGrid::binResidues(Bytes const* isMoved) {
+#pragma omp single
+    {
+        cellCounts.resize(omp_get_num_threads());
+        for (auto& counts: cellCounts) {
+            counts.assign(numCells, 0);
+        }
+
+        cellOf.resize(n);
+        cellStart.resize(numCells + 1);
+        cellIdx.resize(n);
+        if (cellR.size() != n)
+            cellR = Vectors(n);
+    }
+
+    auto& counts = cellCounts[omp_get_thread_num()];
+
+    /* For each pseudoatom (or only for the moved ones), we find which cell
+     * it should belong to, and count the pseudoatoms in each cell. Note that
+     * the static schedule assigns the same (contiguous) range of indices to
+     * a given thread in this loop and the scattering loop below.
+     */
+#pragma omp for schedule(static)
+    for (int i = 0; i < n; ++i) {
+        if (!isMoved || (*isMoved)[i]) {
+            cellOf[i] = sparse ?
+                cellOfKey(residueKeys[i]) :
+                indexOf(locate((*r)[i]));
+        }
+
+        ++counts[cellOf[i]];
+    }
+
+#pragma omp single
+    {
+        /* The prefix sum over the cells (and, within a cell, over the
+         * threads) gives the offsets of the cells and the positions at
+         * which each thread shall place its pseudoatoms. Since the threads
+         * process consecutive ranges of indices, the pseudoatoms in a cell
+         * end up ordered by index, regardless of the number of threads.
+         */
+        int offset = 0;
+        for (int c = 0; c < numCells; ++c) {
+            cellStart[c] = offset;
+            for (auto& threadCounts: cellCounts) {
+                auto count = threadCounts[c];
+                threadCounts[c] = offset;
+                offset += count;
+            }
+        }
+        cellStart[numCells] = offset;
+    }
+
+    /* Now we scatter the indices and the positions into a cell-ordered,
+     * contiguous layout.
+     */
+#pragma omp for schedule(static)
+    for (int i = 0; i < n; ++i) {
+        auto k = counts[cellOf[i]]++;
+        cellIdx[k] = i;
+        cellR[k] = (*r)[i];
+    }
+}
+
+void CellGrid::build(Vectors const& pos, Topology const& topology,
+    double minCellSize) {
+
+#pragma omp single
+    {
+        r = &pos;
+        top = &topology;
+        n = pos.size();
+        bbox = {};
+    }
+
+    /* First, we determine the (axis-aligned) box containing all the
+     * pseudoatoms.
+     */
+    bboxTP = {};
+
+#pragma omp for schedule(static) nowait
+    for (int i = 0; i < n; ++i) {
+        bboxTP.extend((*top)((*r)[i]));
+    }
+
+#pragma omp critical
+    {
+        bbox.extend(bboxTP);
+    }
+#pragma omp barrier
+
+    /* Next, we compute the grid and place the pseudoatoms into the cells.
+     */
+#pragma omp single
+    setup(minCellSize);
+
+    if (sparse) findOccupiedCells(nullptr, nullptr);
+    binResidues(nullptr);
+}
+
+void CellGrid::rebin(Vectors const& pos, Topology const& topology,
+    Bytes const& isMoved, Integers const& moved) {
+
+#pragma omp single
+    {
+        r = &pos;
+        top = &topology;
+    }
+
+    /* With the sparse grid, the cells to which the residues have moved may
+     * need to be added, which changes the indices of the cells, so the
+     * cells of all the residues are recomputed (from the keys).
+     */
+    if (sparse) findOccupiedCells(&isMoved, &moved);
+    binResidues(sparse ? nullptr : &isMoved);
+}
@@ -2,298 +2,696 @@
 #include "simul/Simulation.hpp"
 #include "forces/NonlocalForce.hpp"
 #include <Eigen/Geometry>
+#include <omp.h>
+#include <algorithm>
+#include <chrono>
 using namespace mdk;
 using namespace mdk::vl;
 
 #include <iostream>
 using namespace std;
 
-extern Eigen::AlignedBox3d bboxTP;
-extern std::vector<int> firstTP, lastTP;
-extern Pairs pairsTP;
+extern std::vector<Pairs> sublistsTP;
 
-#pragma omp threadprivate(bboxTP, firstTP, lastTP, pairsTP)
+#pragma omp threadprivate(sublistsTP)
 
-Eigen::AlignedBox3d bboxTP;
-std::vector<int> firstTP, lastTP;
-Pairs pairsTP;
+std::vector<Pairs> sublistsTP;
 
-static Eigen::Vector3i floor(Eigen::Vector3d const& v) {
-    return Eigen::Vector3i {
-        (int)std::floor(v.x()),
-        (int)std::floor(v.y()),
-        (int)std::floor(v.z())
-    };
-}
+void List::addPair(Build& b, int pt1, int pt2, double r12_norm2) {
+    /* The pairs are first checked against the least restrictive spec, which
+     * rejects most of the candidates; the remaining ones are placed into the
+     * sublists of the specs which they satisfy.
+     */
+    if (r12_norm2 > b.effCutoffSq)
+        return;
 
-int List::indexOf(Eigen::Vector3i const& loc) {
-    return loc.x() + grid.x() * (loc.y() + grid.y() * loc.z());
-}
+    /* The pairs are stored with the storage indices, but the bond
+     * separation and the exclusions are defined for the original ones.
+     */
+    auto orig1 = state->origIdx[pt1], orig2 = state->origIdx[pt2];
+    if (!chains->sepByAtLeastN(orig1, orig2, minBondSep))
+        return;
 
-void List::perPair(int c1, int c2) {
-    for (int pt1 = first[c1]; pt1 >= 0; pt1 = next[pt1]) {
-        auto r1 = state->r[pt1];
-        for (int pt2 = first[c2]; pt2 >= 0; pt2 = next[pt2]) {
-            if (pt1 == pt2) continue;
+    bool excluded = isExcluded(min(orig1, orig2), max(orig1, orig2));
 
-            auto r2 = state->r[pt2];
-            auto r12_norm2 = state->top(r2 - r1).squaredNorm();
+    for (int idx = 0; idx < (int)specs.size(); ++idx) {
+        bool cond = r12_norm2 <= b.specEffCutoffSq[idx] &&
+            chains->sepByAtLeastN(orig1, orig2, specs[idx].minBondSep) &&
+            !(excluded && specs[idx].applyExclusions);
 
-            bool cond =
-                r12_norm2 <= effCutoffSq &&
-                (c1 != c2 || pt1 < pt2) &&
-                chains->sepByAtLeastN(pt1, pt2, minBondSep);
+        if (cond) sublistsTP[idx].emplace_back(pt1, pt2);
+    }
+}
 
-            if (cond) {
-                pairsTP.emplace_back(min(pt1, pt2), max(pt1, pt2));
-            }
-        }
+void List::clearSublistsTP() {
+    sublistsTP.resize(specs.size());
+    for (auto& sublist: sublistsTP) {
+        sublist.clear();
     }
 }
 
-void List::perCell(int c1) {
-    Eigen::Vector3i loc1 {
-        c1 % grid.x(),
-        (c1 / grid.x()) % grid.y(),
-        (c1 / grid.x()) / grid.y()
-    };
+void List::scanThreadCounts(Build& b, Integers& starts) {
+    auto n = (int)starts.size() - 1;
+    auto& threadCounts = b.threadCounts;
+    auto numThreads = (int)threadCounts.size();
+
+#pragma omp for schedule(static)
+    for (int b = 0; b < n; ++b) {
+        int sum = 0;
+        for (int t = 0; t < numThreads; ++t) {
+            auto count = threadCounts[t][b];
+            threadCounts[t][b] = sum;
+            sum += count;
+        }
+        starts[b + 1] = sum;
+    }
 
-    Eigen::Vector3i d;
-    for (d.x() = -1; d.x() <= 1; ++d.x()) {
-        for (d.y() = -1; d.y() <= 1; ++d.y()) {
-            for (d.z() = -1; d.z() <= 1; ++d.z()) {
-                Eigen::Vector3i loc2 = loc1 + d;
-                /* This part denotes that the space of the cells is organized
-                 * in a "modular" fashion, i.e. the cells at the opposite sides
-                 * are regarded as neighbours. This is done for the purposes
-                 * of PBC-aware Verlet list construction.
-                 */
-                for (int dim = 0; dim < 3; ++dim) {
-                    if (loc2[dim] >= grid[dim])
-                        loc2[dim] = 0;
-
-                    if (loc2[dim] < 0)
-                        loc2[dim] = grid[dim] - 1;
-                }
+#pragma omp single
+    {
+        starts[0] = 0;
+        for (int b = 0; b < n; ++b) {
+            starts[b + 1] += starts[b];
+        }
+    }
 
-                auto c2 = indexOf(loc2);
-                if (c1 <= c2) perPair(c1, c2);
-            }
+#pragma omp for schedule(static)
+    for (int b = 0; b < n; ++b) {
+        for (int t = 0; t < numThreads; ++t) {
+            threadCounts[t][b] += starts[b];
         }
     }
 }
 
-void List::updateGrid() {
-    Eigen::Vector3d cell;
-    int gridSize;
-    Eigen::AlignedBox3d bbox;
+void List::gatherSublistsTP(Build& b,
+    std::vector<NeighbourList> const* kept) {
+
+    /* The thread-private lists are gathered into the sublists in the CSR
+     * format without any critical sections, atomics or sorting, with a
+     * two-pass counting sort: the pairs are first bucketed by the second
+     * residue, and then (stably) by the first one, so that each row comes
+     * out sorted. In each pass every thread counts its pairs in each bucket,
+     * the counts are prefix-summed over the buckets and the threads, and
+     * then each thread copies its pairs into its own slots. The result does
+     * not depend on the number of threads or on the scheduling. If \p kept
+     * is given, the pairs therein not involving the moved residues are
+     * retained as well; each thread takes the ones from a range of rows.
+     */
+    auto n = state->n;
+    auto numThreads = omp_get_num_threads(), thread = omp_get_thread_num();
+    auto rangeBegin = (int)((int64_t)n * thread / numThreads),
+        rangeEnd = (int)((int64_t)n * (thread + 1) / numThreads);
 
-    effCutoff = cutoff + pad;
-    effCutoffSq = pow(effCutoff, 2.0);
-
-    pairs.clear();
-
-#pragma omp parallel
+#pragma omp barrier
+#pragma omp single
     {
-        /* First, we determine the (axis-aligned) box containing all the
-         * pseudoatoms.
-         */
-        bboxTP = {};
+        b.threadCounts.resize(numThreads);
+        b.colStart.resize(n + 1);
+    }
+    auto& counts = b.threadCounts[thread];
+    auto& colStart = b.colStart;
+    auto& colIs = b.colIs;
+
+    for (int idx = 0; idx < (int)specs.size(); ++idx) {
+        auto const& pairs = sublistsTP[idx];
+        auto& out = (*b.out)[idx];
+
+        auto forEachKept = [&](auto const& f) -> void {
+            if (!kept) return;
+            auto const& old = (*kept)[idx];
+            for (int i = rangeBegin; i < rangeEnd; ++i) {
+                if (isMoved[i]) continue;
+                for (int k = old.offsets[i]; k < old.offsets[i+1]; ++k) {
+                    if (!isMoved[old.js[k]]) f(i, old.js[k]);
+                }
+            }
+        };
 
-#pragma omp for schedule(dynamic, 10) nowait
-        for (int i = 0; i < state->n; ++i) {
-            bboxTP.extend(state->top(state->r[i]));
-        }
+        counts.assign(n, 0);
+        for (auto const& [i, j]: pairs) ++counts[j];
+        forEachKept([&](int, int j) -> void { ++counts[j]; });
+#pragma omp barrier
 
-#pragma omp critical
+        scanThreadCounts(b, colStart);
+#pragma omp single
         {
-            bbox.extend(bboxTP);
+            colIs.resize(colStart[n]);
+            out.offsets.resize(n + 1);
         }
+
+        for (auto const& [i, j]: pairs) colIs[counts[j]++] = i;
+        forEachKept([&](int i, int j) -> void { colIs[counts[j]++] = i; });
 #pragma omp barrier
 
+        /* In the second pass each thread goes through a range of the
+         * columns in order, so the rows are filled in the order of the
+         * second residue.
+         */
+        counts.assign(n, 0);
+        for (int j = rangeBegin; j < rangeEnd; ++j) {
+            for (int k = colStart[j]; k < colStart[j+1]; ++k)
+                ++counts[colIs[k]];
+        }
+#pragma omp barrier
+
+        scanThreadCounts(b, out.offsets);
 #pragma omp single
         {
-            /* Next, we compute the integral size of the grid, and consequently
-             * adjust the cell sizes. They will be slightly larger than
-             * \p effCutoff. This is done in order to have the bounding box
-             * divided into an integral number of cells along each axis, as
-             * otherwise some would intuitively "stick out" which would be
-             * troublesome for computing neighbors with PBC.
-             */
-            grid = floor(bbox.sizes() / effCutoff);
-            for (int dim = 0; dim < 3; ++dim) {
-                if (grid[dim] == 0) grid[dim] = 1;
-            }
+            out.js.resize(out.offsets[n]);
+        }
+
+        for (int j = rangeBegin; j < rangeEnd; ++j) {
+            for (int k = colStart[j]; k < colStart[j+1]; ++k)
+                out.js[counts[colIs[k]]++] = j;
+        }
+#pragma omp barrier
+    }
+}
+
+void List::perPair(Build& b, int c1, int c2) {
+    auto const& cells = b.cells;
+    for (int k1 = cells.cellStart[c1]; k1 < cells.cellStart[c1+1]; ++k1) {
+        auto pt1 = cells.cellIdx[k1];
+        auto r1 = cells.cellR[k1];
+        for (int k2 = cells.cellStart[c2]; k2 < cells.cellStart[c2+1]; ++k2) {
+            auto pt2 = cells.cellIdx[k2];
+            auto r2 = cells.cellR[k2];
+            auto r12_norm2 = (*b.top)(r2 - r1).squaredNorm();
+            addPair(b, min(pt1, pt2), max(pt1, pt2), r12_norm2);
+        }
+    }
+}
 
-            cell = Eigen::Vector3d {
-                bbox.sizes().x() / grid.x(),
-                bbox.sizes().y() / grid.y(),
-                bbox.sizes().z() / grid.z()
-            };
+void List::perSelf(Build& b, int c) {
+    /* Within a single cell we only go through the pairs of residues which
+     * come later in the cell, so that each pair is considered once. As the
+     * residues in a cell are ordered by index, we have pt1 < pt2.
+     */
+    auto const& cells = b.cells;
+    for (int k1 = cells.cellStart[c]; k1 < cells.cellStart[c+1]; ++k1) {
+        auto pt1 = cells.cellIdx[k1];
+        auto r1 = cells.cellR[k1];
+        for (int k2 = k1 + 1; k2 < cells.cellStart[c+1]; ++k2) {
+            auto pt2 = cells.cellIdx[k2];
+            auto r2 = cells.cellR[k2];
+            auto r12_norm2 = (*b.top)(r2 - r1).squaredNorm();
+            addPair(b, pt1, pt2, r12_norm2);
+        }
+    }
+}
 
-            gridSize = grid.x() * grid.y() * grid.z();
+void List::perCell(Build& b, int c1) {
+    b.cells.forEachHalfShell(c1, [&](int c2) -> void {
+        if (c2 == c1) perSelf(b, c1);
+        else perPair(b, c1, c2);
+    });
+}
 
-            /* Then, we initialize the linked lists for each cell and the
-             * \p next indicators.
-             */
-            first.resize(gridSize);
-            std::fill(first.begin(), first.end(), -1);
+void List::perMoved(Build& b, int pt1) {
+    /* We look for the partners of a moved residue in all the neighbouring
+     * cells; the pairs of moved residues are taken from the one with the
+     * lower index.
+     */
+    auto const& cells = b.cells;
+    int neighbours[27];
+    int numNeighbours = cells.neighbourCells(cells.cellOf[pt1], neighbours);
+
+    auto r1 = (*b.r)[pt1];
+    for (int nb = 0; nb < numNeighbours; ++nb) {
+        auto c2 = neighbours[nb];
+        for (int k2 = cells.cellStart[c2]; k2 < cells.cellStart[c2+1]; ++k2) {
+            auto pt2 = cells.cellIdx[k2];
+            if (pt2 == pt1 || (isMoved[pt2] && pt2 < pt1)) continue;
+
+            auto r2 = cells.cellR[k2];
+            auto r12_norm2 = (*b.top)(r2 - r1).squaredNorm();
+            addPair(b, min(pt1, pt2), max(pt1, pt2), r12_norm2);
+        }
+    }
+}
 
-            last.resize(gridSize);
-            std::fill(last.begin(), last.end(), -1);
+void List::updateGrid(Build& b) {
+#pragma omp parallel num_threads(b.numThreads)
+    {
+        /* First, we place the pseudoatoms into the cells.
+         */
+        b.cells.build(*b.r, *b.top, b.effCutoff);
+        clearSublistsTP();
 
-            next.resize(state->n);
-            std::fill(next.begin(), next.end(), -1);
+        /* Next, we go through the cells and investigate the pairs of
+         * neighbouring cells.
+         */
+#pragma omp for schedule(dynamic, 10) nowait
+        for (int c1 = 0; c1 < b.cells.numCells; ++c1) {
+            perCell(b, c1);
         }
-#pragma omp barrier
 
-        firstTP.resize(gridSize);
-        std::fill(firstTP.begin(), firstTP.end(), -1);
+        /* Finally, we gather the thread-private lists into the sublists.
+         */
+        gatherSublistsTP(b, nullptr);
+    }
 
-        lastTP.resize(gridSize);
-        std::fill(lastTP.begin(), lastTP.end(), -1);
+    b.haveGrid = true;
+}
 
-#pragma omp for schedule(dynamic, 10) nowait
-        for (int i = 0; i < state->n; ++i) {
-            auto v = state->top(state->r[i]);
-
-            /* For each pseudoatom, we find which cell it should belong to,
-             * and add it to the appropriate linked list.
-             */
-            Eigen::Vector3i loc = {
-                (int)std::floor((v.x() - bbox.min().x()) / cell.x()),
-                (int)std::floor((v.y() - bbox.min().y()) / cell.y()),
-                (int)std::floor((v.z() - bbox.min().z()) / cell.z()),
-            };
-
-            /* This is just for edge cases. */
-            for (int dim = 0; dim < 3; ++dim) {
-                if (loc[dim] >= grid[dim])
-                    loc[dim] = grid[dim]-1;
-            }
+void List::update(Build& b) {
+    #pragma omp parallel num_threads(b.numThreads)
+    {
+        clearSublistsTP();
 
-            int c = indexOf(loc);
-            if (firstTP[c] < 0) {
-                firstTP[c] = lastTP[c] = i;
-            } else {
-                next[lastTP[c]] = i;
-                lastTP[c] = i;
+        #pragma omp for schedule(dynamic, 10) nowait
+        for (int pt1 = 0; pt1 < state->n; ++pt1) {
+            auto r1 = (*b.r)[pt1];
+            for (int pt2 = pt1+1; pt2 < state->n; ++pt2) {
+                auto r2 = (*b.r)[pt2];
+                auto r12_norm2 = (*b.top)(r2 - r1).squaredNorm();
+                addPair(b, pt1, pt2, r12_norm2);
             }
         }
 
-        /* Here we merge the thread-private lists into a single one.
+        gatherSublistsTP(b, nullptr);
+    }
+
+    b.haveGrid = false;
+}
+
+void List::patch() {
+    /* The list is patched with the grid and the cutoffs of the build from
+     * which it comes.
+     */
+    auto& b = currentBuild;
+    b.r = &r0;
+    b.top = &state->top;
+    b.out = &builtSublists();
+    b.numThreads = omp_get_max_threads();
+
+    std::swap(*b.out, keptSublists);
+    b.out->resize(specs.size());
+
+#pragma omp parallel num_threads(b.numThreads)
+    {
+        /* The moved residues get new reference positions, and are placed
+         * into the appropriate cells.
          */
-#pragma omp critical
-        {
-            for (int c = 0; c < gridSize; ++c) {
-                if (firstTP[c] < 0)
-                    continue;
-
-                if (first[c] < 0) {
-                    first[c] = firstTP[c];
-                } else {
-                    next[last[c]] = firstTP[c];
-                }
-                last[c] = lastTP[c];
-            }
+#pragma omp for schedule(static)
+        for (int m = 0; m < (int)moved.size(); ++m) {
+            auto i = moved[m];
+            r0[i] = state->r[i];
         }
-#pragma omp barrier
 
-        pairsTP.clear();
+        b.cells.rebin(*b.r, *b.top, isMoved, moved);
+        clearSublistsTP();
 
-        /* Next, we go through the cells and investigate the pairs of
-         * neighbouring cells.
-         */
 #pragma omp for schedule(dynamic, 10) nowait
-        for (int c1 = 0; c1 < gridSize; ++c1) {
-            perCell(c1);
+        for (int m = 0; m < (int)moved.size(); ++m) {
+            perMoved(b, moved[m]);
         }
 
-        /* Finally, we merge thread-private lists into a single one.
-         */
-#pragma omp critical
-        {
-            pairs.insert(pairs.end(), pairsTP.begin(), pairsTP.end());
-        }
+        gatherSublistsTP(b, &keptSublists);
+    }
+}
+
+bool List::tryPatch() {
+    /* The list can be patched only if it was built with the cell version,
+     * and the box has not changed.
+     */
+    if (!incremental || initial || !currentBuild.haveGrid)
+        return false;
+    if (top0.cell != state->top.cell)
+        return false;
+
+    /* The pairs in the list are determined by the reference positions of
+     * both residues, which are now tracked individually; if every residue
+     * is within half of the padding from its reference position, the list
+     * contains all the pairs within the cutoff distance. We thus give new
+     * reference positions to the residues which have moved by more than a
+     * quarter of the padding, which leaves the others at least a quarter
+     * of the padding until the next update.
+     */
+    auto thresholdSq = pow(listPad / 4.0, 2.0);
+    isMoved.resize(state->n);
+
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < state->n; ++i) {
+        isMoved[i] = (state->r[i] - r0[i]).squaredNorm() >= thresholdSq;
     }
 
-    sort(pairs.begin(), pairs.end());
-    for (auto& force: forces) {
-        force->vlUpdateHook();
+    moved.clear();
+    for (int i = 0; i < state->n; ++i) {
+        if (isMoved[i]) moved.push_back(i);
     }
+
+    if (moved.size() > maxMovedFraction * state->n)
+        return false;
+
+    t0 = state->t;
+    patch();
+    activate();
+    return true;
 }
 
-void List::update() {
-    effCutoff = cutoff + pad;
-    effCutoffSq = pow(effCutoff, 2.0);
+void List::prepareBuild(Build& b, Vectors const& r, Topology const& top,
+    double buildPad, std::vector<NeighbourList>& out, int numThreads) const {
+
+    b.r = &r;
+    b.top = &top;
+    b.out = &out;
+    b.numThreads = numThreads;
+    b.pad = buildPad;
+    b.useGrid = algorithm == Algorithm::CELL ||
+        (algorithm == Algorithm::AUTO && state->n >= minCellResidues);
+
+    b.effCutoff = cutoff + buildPad;
+    b.effCutoffSq = pow(b.effCutoff, 2.0);
+
+    b.specEffCutoffSq.resize(specs.size());
+    for (int idx = 0; idx < (int)specs.size(); ++idx) {
+        b.specEffCutoffSq[idx] = specUsers[idx] > 0
+            ? pow(sqrt(specs[idx].cutoffSq) + buildPad, 2.0)
+            : -1.0;
+    }
+}
 
-    pairs.clear();
+void List::build(Build& b) {
+    b.out->resize(specs.size());
+    if (b.useGrid) updateGrid(b);
+    else update(b);
+}
 
-    #pragma omp parallel
+void List::runHooks() {
+    /* The hooks only read the list, so they run concurrently. */
+#pragma omp parallel
+#pragma omp single
     {
-        pairsTP.clear();
+        for (auto& force: forces) {
+#pragma omp task firstprivate(force)
+            force->vlUpdateHook();
+        }
+    }
+}
 
-        #pragma omp for schedule(dynamic, 10) nowait
-        for (int pt1 = 0; pt1 < r0.size(); ++pt1) {
-            auto r1 = state->r[pt1];
-            for (int pt2 = pt1+1; pt2 < r0.size(); ++pt2) {
-                auto r2 = state->r[pt2];
-                auto r12_norm2 = state->top(r2 - r1).squaredNorm();
+std::vector<NeighbourList>& List::builtSublists() {
+    return pruning ? outerSublists : sublists;
+}
 
-                bool cond = r12_norm2 <= effCutoffSq &&
-                    chains->sepByAtLeastN(pt1, pt2, minBondSep);
+void List::activate() {
+    if (pruning) {
+        pruneSublists(outerSublists, sublists);
+        pruneR = state->r;
+        pruneTop = state->top;
+        prunePending = false;
+    }
 
-                if (cond) pairsTP.emplace_back(pt1, pt2);
-            }
-        }
+    runHooks();
+}
 
-        #pragma omp critical
-        {
-            pairs.insert(pairs.end(), pairsTP.begin(), pairsTP.end());
+void List::sortSpatially() {
+    auto const& r = state->r;
+    auto n = state->n;
+    auto cellSize = cutoff + pad;
+    Vector origin = r.rowwise().minCoeff();
+
+    /* The key of a residue interleaves the bits of the (21-bit) coordinates
+     * of its cell.
+     */
+    auto spread = [](uint64_t x) -> uint64_t {
+        x &= 0x1fffff;
+        x = (x | (x << 32)) & 0x1f00000000ffffULL;
+        x = (x | (x << 16)) & 0x1f0000ff0000ffULL;
+        x = (x | (x << 8)) & 0x100f00f00f00f00fULL;
+        x = (x | (x << 4)) & 0x10c30c30c30c30c3ULL;
+        x = (x | (x << 2)) & 0x1249249249249249ULL;
+        return x;
+    };
+
+    std::vector<uint64_t> keys(n);
+#pragma omp parallel for schedule(static)
+    for (int k = 0; k < n; ++k) {
+        uint64_t key = 0;
+        for (int dim = 0; dim < 3; ++dim) {
+            auto c = (uint64_t)((r(dim, k) - origin[dim]) / cellSize);
+            key |= spread(c) << dim;
         }
+        keys[k] = key;
     }
 
-    sort (pairs.begin(), pairs.end());
-    for (auto& force: forces) {
-        force->vlUpdateHook();
+    Integers order(n);
+    for (int k = 0; k < n; ++k) order[k] = state->origIdx[k];
+    std::sort(order.begin(), order.end(), [&](int i1, int i2) -> bool {
+        auto key1 = keys[state->sortedIdx[i1]], key2 = keys[state->sortedIdx[i2]];
+        return key1 < key2 || (key1 == key2 && i1 < i2);
+    });
+    for (auto& k: order) k = state->sortedIdx[k];
+
+    state->permute(order);
+}
+
+void List::rebuild() {
+    if (spatialOrder) sortSpatially();
+
+    t0 = state->t;
+    r0 = state->r;
+    top0 = state->top;
+    listPad = pad;
+
+    prepareBuild(currentBuild, state->r, state->top, pad, builtSublists(),
+        omp_get_max_threads());
+    build(currentBuild);
+    activate();
+}
+
+void List::startBackgroundBuild() {
+    /* The list is built from a snapshot of the state, so that the positions
+     * may be freely modified by the integrator in the meantime.
+     */
+    snapT = state->t;
+    snapR = state->r;
+    snapTop = state->top;
+
+    /* The parameters (which may be changed, e.g. by the autotuner, while
+     * the list is being built) are fixed here, and the build has its own
+     * grid and scratch arrays, so that the thread doesn't write anything
+     * the synchronous updates use.
+     */
+    prepareBuild(backgroundBuild, snapR, snapTop, pad + backgroundExtraPad,
+        nextSublists, backgroundThreads);
+
+    pendingBuild = std::async(std::launch::async, [this]() -> void {
+        build(backgroundBuild);
+    });
+}
+
+void List::finishBackgroundBuild() {
+    pendingBuild.get();
+
+    t0 = snapT;
+    std::swap(r0, snapR);
+    top0 = snapTop;
+    listPad = backgroundBuild.pad;
+
+    /* The grid of the new list is used for patching it. */
+    std::swap(currentBuild, backgroundBuild);
+
+    std::swap(builtSublists(), nextSublists);
+    activate();
+}
+
+void List::pruneSublists(std::vector<NeighbourList> const& in,
+    std::vector<NeighbourList>& out) const {
+
+    out.resize(in.size());
+    for (int idx = 0; idx < (int)in.size(); ++idx) {
+        auto radiusSq = pow(sqrt(specs[idx].cutoffSq) + prunePad, 2.0);
+        auto const& src = in[idx];
+        auto& dst = out[idx];
+
+        dst.offsets.resize(src.offsets.size());
+        dst.offsets[0] = 0;
+        dst.js.clear();
+
+        for (int i = 0; i < src.numRows(); ++i) {
+            auto r1 = state->r[i];
+            for (int k = src.offsets[i]; k < src.offsets[i+1]; ++k) {
+                auto j = src.js[k];
+                auto r12_norm2 = state->top(state->r[j] - r1).squaredNorm();
+                if (r12_norm2 <= radiusSq) dst.js.push_back(j);
+            }
+            dst.offsets[i+1] = (int)dst.js.size();
+        }
     }
 }
 
-bool List::needToReset() const {
-    if (initial) return true;
-    if (t0 == state->t) return false;
+void List::pruneTask() {
+    /* Executed as an async task, i.e. by a single thread during the
+     * computation of the forces, when the positions are fixed; the pruned
+     * lists are swapped in at the beginning of the next step. We start
+     * pruning once half of the budget of the current pruned lists is used,
+     * so that a synchronous pruning is (usually) not necessary.
+     */
+    if (!pruning || prunePending) return;
+    if (displacement(pruneR, pruneTop) < prunePad / 4.0) return;
+
+    pruneSublists(outerSublists, nextPruned);
+    nextPruneR = state->r;
+    nextPruneTop = state->top;
+    prunePending = true;
+}
 
+double List::displacement(Vectors const& ref, Topology const& refTop) const {
     auto maxMoveSq = 0.0;
+
+#pragma omp parallel for schedule(static) reduction(max: maxMoveSq)
     for (int i = 0; i < state->n; ++i) {
-        auto moveSq = (state->r[i] - r0[i]).squaredNorm();
+        auto moveSq = (state->r[i] - ref[i]).squaredNorm();
         maxMoveSq = std::max(maxMoveSq, moveSq);
     }
 
     auto maxMove = sqrt(maxMoveSq);
-    auto pbcShift = (top0.cell - state->top.cell).lpNorm<1>();
-    return maxMove + 2.0 * pbcShift >= pad / 2.0;
+    auto pbcShift = (refTop.cell - state->top.cell).lpNorm<1>();
+    return maxMove + 2.0 * pbcShift;
+}
+
+bool List::needToReset() const {
+    if (initial || invalidated) return true;
+    if (t0 == state->t) return false;
+
+    return displacement(r0, top0) >= listPad / 2.0;
 }
 
 void List::bind(Simulation &simulation) {
     state = &simulation.var<State>();
     chains = &simulation.data<Chains>();
     initial = true;
+
+    simulation.addAsyncTask([this]() -> void {
+        pruneTask();
+    });
 }
 
 void List::check() {
+    if (initial) pruning = prune;
+
+    /* If a list is being built in the background, we swap it in as soon as
+     * it's ready, or (waiting for it) when the current one is no longer
+     * valid. In the latter case the new list may have become invalid too,
+     * if the residues moved too much while it was being built, in which case
+     * we fall back to the synchronous reconstruction.
+     */
+    auto then = std::chrono::steady_clock::now();
+    auto prevUpdates = numUpdates;
+
+    if (pendingBuild.valid()) {
+        auto status = pendingBuild.wait_for(std::chrono::seconds(0));
+        if (status == std::future_status::ready || needToReset()) {
+            finishBackgroundBuild();
+            ++numUpdates;
+        }
+    }
+
     if (needToReset()) {
-        t0 = state->t;
-        r0 = state->r;
-        top0 = state->top;
-        update();
+        if (invalidated || !tryPatch()) rebuild();
+        invalidated = false;
+        ++numUpdates;
     }
+    else {
+        /* The pruned lists computed during the previous step are swapped in;
+         * if there are none and the current ones are no longer valid, we
+         * prune the lists synchronously.
+         */
+        if (prunePending) {
+            std::swap(sublists, nextPruned);
+            std::swap(pruneR, nextPruneR);
+            pruneTop = nextPruneTop;
+            prunePending = false;
+            runHooks();
+        }
+        else if (pruning && displacement(pruneR, pruneTop) >= prunePad / 2.0) {
+            activate();
+        }
+
+        if (background && !pendingBuild.valid() &&
+            displacement(r0, top0) >= listPad / 4.0) {
+            startBackgroundBuild();
+        }
+    }
+
     initial = false;
+
+    if (numUpdates != prevUpdates) {
+        auto now = std::chrono::steady_clock::now();
+        updateTime += std::chrono::duration<double>(now - then).count();
+    }
+}
+
+void List::invalidate() {
+    invalidated = true;
 }
 
-void List::registerNF(NonlocalForce& force, Spec const& spec) {
+double List::budgetUsed() const {
+    return displacement(r0, top0) / (listPad / 2.0);
+}
+
+List::~List() {
+    if (pendingBuild.valid()) pendingBuild.wait();
+}
+
+void List::addExclusions(Pairs const& pairs) {
+    exclusions.insert(exclusions.end(), pairs.begin(), pairs.end());
+    std::sort(exclusions.begin(), exclusions.end());
+    exclusions.erase(std::unique(exclusions.begin(), exclusions.end()),
+        exclusions.end());
+
+    int numRows = exclusions.empty() ? 0 : exclusions.back().first + 1;
+    exclusionStart.assign(numRows + 1, 0);
+    for (auto const& [i1, i2]: exclusions) {
+        ++exclusionStart[i1 + 1];
+    }
+    for (int i = 0; i < numRows; ++i) {
+        exclusionStart[i + 1] += exclusionStart[i];
+    }
+}
+
+bool List::isExcluded(int i1, int i2) const {
+    if (i1 + 1 >= (int)exclusionStart.size()) return false;
+
+    auto first = exclusions.begin() + exclusionStart[i1];
+    auto last = exclusions.begin() + exclusionStart[i1 + 1];
+    return std::binary_search(first, last, std::make_pair(i1, i2));
+}
+
+int List::registerNF(NonlocalForce& force, Spec const& spec) {
     cutoff = std::max(cutoff, sqrt(spec.cutoffSq));
     if (minBondSep < 1) minBondSep = spec.minBondSep;
     else minBondSep = std::min(minBondSep, spec.minBondSep);
 
     forces.push_back(&force);
+
+    for (int idx = 0; idx < (int)specs.size(); ++idx) {
+        bool same = specs[idx].cutoffSq == spec.cutoffSq &&
+            specs[idx].minBondSep == spec.minBondSep &&
+            specs[idx].applyExclusions == spec.applyExclusions;
+        if (same) {
+            ++specUsers[idx];
+            return idx;
+        }
+    }
+
+    specs.push_back(spec);
+    specUsers.push_back(1);
+    return (int)specs.size() - 1;
+}
+
+void List::unregisterNF(NonlocalForce& force, int idx) {
+    forces.erase(std::remove(forces.begin(), forces.end(), &force),
+        forces.end());
+    --specUsers[idx];
+
+    cutoff = 0.0;
+    minBondSep = 0;
+    for (int k = 0; k < (int)specs.size(); ++k) {
+        if (specUsers[k] == 0) continue;
+
+        cutoff = std::max(cutoff, sqrt(specs[k].cutoffSq));
+        if (minBondSep < 1) minBondSep = specs[k].minBondSep;
+        else minBondSep = std::min(minBondSep, specs[k].minBondSep);
+    }
 }
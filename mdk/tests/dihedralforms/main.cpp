@@ -0,0 +1,307 @@
+#include <mdk/simul/Simulation.hpp>
+#include <mdk/files/pdb/Parser.hpp>
+#include <mdk/files/param/LegacyParser.hpp>
+#include <mdk/system/LangPredictorCorrector.hpp>
+#include <mdk/forces/dihedral/DihedralAngles.hpp>
+#include <mdk/forces/dihedral/HeuresticDihedral.hpp>
+#include <mdk/forces/dihedral/ComplexNativeDihedral.hpp>
+#include <mdk/forces/dihedral/SimpleNativeDihedral.hpp>
+#include <mdk/data/Chains.hpp>
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <random>
+#include <cmath>
+using namespace mdk;
+using namespace std;
+
+/**
+ * Standalone copies of the formulas of the dihedral terms in the form they
+ * had before the terms were evaluated from the cosine and the sine of the
+ * angle, i.e. as functions of the angle itself; they serve as the reference.
+ */
+namespace reference {
+    void heurestic(double const* C, double phi, double& V, double& dV_dphi) {
+        double sin_phi = sin(phi), cos_phi = cos(phi);
+        double sin_2_phi = sin_phi * sin_phi;
+        double cos_2_phi = cos_phi * cos_phi;
+
+        V += C[0]
+           + C[1] * sin_phi
+           + C[2] * cos_phi
+           + C[3] * sin_2_phi
+           + C[4] * cos_2_phi
+           + C[5] * sin_phi * cos_phi;
+
+        dV_dphi += C[1] * cos_phi
+                 - C[2] * sin_phi
+                 + 2.0 * (C[3] - C[4]) * sin_phi * cos_phi
+                 + C[5] * (cos_2_phi - sin_2_phi);
+    }
+
+    void complexNative(double CDA, double CDB, double phi0, double phi,
+        double& V, double& dV_dphi) {
+
+        V += CDA * (1.0 - cos(phi - phi0)) +
+             CDB * (1.0 - cos(3.0 * (phi - phi0)));
+
+        dV_dphi += CDA * sin(phi - phi0) +
+                   3.0 * CDB * sin(3.0 * (phi - phi0));
+    }
+
+    void simpleNative(double CDH, double phi0, double phi, double& V,
+        double& dV_dphi) {
+
+        auto diff = phi - phi0;
+        V += 0.5 * CDH * diff * diff;
+        dV_dphi += CDH * diff;
+    }
+
+    /**
+     * The dihedral force for all the quadruples (i-2, i-1, i, i+1) of a
+     * configuration, with the angle computed from its cosine with \p acos
+     * and signed by (r12 x r23) . r34.
+     * @param term Term of the potential, invoked as term(i, phi, V, dV_dphi).
+     */
+    template<typename Term>
+    void quads(Vectors const& r, Bytes const& inRange, Term const& term,
+        double& V, Vectors& F) {
+
+        for (int i = 0; i < (int) inRange.size(); ++i) {
+            if (!inRange[i]) continue;
+
+            auto r1 = r[i-2], r2 = r[i-1], r3 = r[i], r4 = r[i+1];
+            Vector r12 = r2 - r1, r23 = r3 - r2, r34 = r4 - r3;
+            auto r23_norm = r23.norm();
+
+            Vector r12_x_r23 = r12.cross(r23), r23_x_r34 = r23.cross(r34);
+            auto r12_x_r23_normsq = r12_x_r23.squaredNorm();
+            auto r23_x_r34_normsq = r23_x_r34.squaredNorm();
+            if (r12_x_r23_normsq == 0.0 || r23_x_r34_normsq == 0.0)
+                continue;
+
+            auto r12_x_r23_norm = sqrt(r12_x_r23_normsq);
+            Vector unit_r12_x_r23 = r12_x_r23 / r12_x_r23_norm;
+
+            auto r23_x_r34_norm = sqrt(r23_x_r34_normsq);
+            Vector unit_r23_x_r34 = r23_x_r34 / r23_x_r34_norm;
+
+            auto cos_phi = unit_r12_x_r23.dot(unit_r23_x_r34);
+            cos_phi = max(min(cos_phi, 1.0), -1.0);
+            auto phi = acos(cos_phi), dV_dphi = 0.0;
+            if (r12_x_r23.dot(r34) < 0.0) phi = -phi;
+
+            term(i, phi, V, dV_dphi);
+
+            Vector dphi_dr1 = -unit_r12_x_r23 * r23_norm / r12_x_r23_norm;
+            Vector dphi_dr4 = unit_r23_x_r34 * r23_norm / r23_x_r34_norm;
+            Vector df = (-dphi_dr1*r12.dot(r23)+dphi_dr4*r23.dot(r34));
+            df /= (r23_norm * r23_norm);
+            Vector dphi_dr2 = -dphi_dr1 + df;
+            Vector dphi_dr3 = -dphi_dr4 - df;
+
+            F[i-2] -= dV_dphi * dphi_dr1;
+            F[i-1] -= dV_dphi * dphi_dr2;
+            F[i] -= dV_dphi * dphi_dr3;
+            F[i+1] -= dV_dphi * dphi_dr4;
+        }
+    }
+}
+
+/**
+ * 1UBQ (in the setup of the \p posDiff example), morphed into a self-avoiding
+ * walk, so that the dihedral angles are far from the native ones and take
+ * all the values.
+ */
+struct Setup {
+    Model model;
+    param::Parameters params;
+
+    Setup() {
+        ifstream pdbFile(DATA_DIR "/1ubq.pdb");
+        auto atomic = pdb::Parser().read(pdbFile).asModel();
+        model = atomic.coarsen();
+
+        ifstream paramFile(DATA_DIR "/parametersMJ96.txt");
+        params = param::LegacyParser().read(paramFile);
+
+        auto rand = Random(448);
+        model.legacyMorphIntoSAW(rand, false, 0, 4.56 * angstrom, true);
+    }
+
+    /**
+     * Native dihedral angles of the quadruples, as derived from the
+     * structured parts of the model.
+     */
+    Scalars nativePhi() const {
+        Scalars phi0 = Scalars::Constant(model.n, NAN);
+        for (auto const& ch: model.chains) {
+            for (auto const& spIdx: ch.structuredParts) {
+                auto const& sp = model.structuredParts[spIdx];
+                for (int i = ch.start + sp.off + 2;
+                    i < ch.start + sp.off + sp.len - 1; ++i) {
+                    phi0[i] = sp.dihedral[i - (ch.start + sp.off)];
+                }
+            }
+        }
+        return phi0;
+    }
+};
+
+/**
+ * Computes the dihedral force of the configuration of \p setup with the
+ * \p DihedralAngles force (with the part \p Part) and with the reference
+ * formula, and compares the energies and the forces; the differences are
+ * relative to the energy and to the largest force. The angle computed with
+ * \p acos loses about half of the digits near 0 and pi, hence the
+ * tolerance.
+ */
+template<typename Part, typename Term>
+bool check(char const* name, Setup const& setup, Term const& term) {
+    Simulation simul(setup.model, setup.params);
+    simul.add<Random>(448);
+    simul.add<LangPredictorCorrector>(0.005 * tau);
+    simul.add<Part>();
+
+    auto& dihedrals = simul.var<DihedralAngles>();
+    auto& state = simul.var<State>();
+    auto inRange = simul.data<Chains>().quads;
+    simul.init();
+
+    Dynamics dyn;
+    dyn.zero(state.n);
+    dihedrals.asyncPart(dyn);
+
+    double V_ref = 0.0;
+    Vectors F_ref(state.n, Vector::Zero());
+    reference::quads(state.r, inRange, term, V_ref, F_ref);
+
+    double maxF = 0.0, errF = 0.0;
+    for (int i = 0; i < state.n; ++i) {
+        maxF = max(maxF, F_ref[i].norm());
+        errF = max(errF, (dyn.F[i] - F_ref[i]).norm());
+    }
+    auto errV = abs(dyn.V - V_ref) / abs(V_ref);
+    errF /= maxF;
+
+    bool ok = errV < 1.0e-8 && errF < 1.0e-6;
+    cout << "[" << name << "] " << (ok ? "OK" : "MISMATCH") << '\n'
+         << "  V (reference)     = " << V_ref << '\n'
+         << "  Max error (V)     = " << errV << '\n'
+         << "  Max error (F)     = " << errF << '\n';
+
+    return ok;
+}
+
+/**
+ * Maximum differences between a dihedral term evaluated from the cosine and
+ * the sine of the angle and its reference formula, and between the
+ * derivative of the former and the central difference of its potential.
+ */
+struct Errors {
+    double V = 0.0, dV = 0.0, dV_numeric = 0.0;
+
+    void update(double V_ref, double dV_ref, double V, double dV,
+        double dV_num, double scale) {
+
+        this->V = max(this->V, abs(V - V_ref) / scale);
+        this->dV = max(this->dV, abs(dV - dV_ref) / scale);
+        dV_numeric = max(dV_numeric, abs(dV - dV_num) / scale);
+    }
+
+    bool ok() const {
+        return V < 1.0e-12 && dV < 1.0e-12 && dV_numeric < 1.0e-6;
+    }
+};
+
+void report(char const* name, Errors const& err) {
+    cout << "[" << name << "] " << (err.ok() ? "OK" : "MISMATCH") << '\n'
+         << "  Max error (V)           = " << err.V << '\n'
+         << "  Max error (dV/dphi)     = " << err.dV << '\n'
+         << "  Max error (numeric der) = " << err.dV_numeric << '\n';
+}
+
+/**
+ * Compares the cosine-sine-based evaluation of the heurestic and the
+ * complex native dihedral terms with the reference formulas, over random
+ * angles (and coefficients); then compares the whole \p DihedralAngles
+ * force, with each of the parts, with the reference computation on the
+ * quadruples of 1UBQ.
+ */
+int main() {
+    mt19937 gen(1234);
+    uniform_real_distribution<double> angle(-M_PI, M_PI), coeff(-1.0, 1.0);
+    auto const h = 1.0e-6;
+    int const numSamples = 100'000;
+
+    Errors heurErr;
+    for (int it = 0; it < numSamples; ++it) {
+        double C[6];
+        for (auto& c: C) c = coeff(gen);
+        auto phi = angle(gen);
+
+        double V_ref = 0.0, dV_ref = 0.0, V = 0.0, dV = 0.0;
+        reference::heurestic(C, phi, V_ref, dV_ref);
+        HeuresticDihedral::eval(C, cos(phi), sin(phi), V, dV);
+
+        double V_lo = 0.0, V_hi = 0.0, dummy = 0.0;
+        HeuresticDihedral::eval(C, cos(phi - h), sin(phi - h), V_lo, dummy);
+        HeuresticDihedral::eval(C, cos(phi + h), sin(phi + h), V_hi, dummy);
+        auto dV_num = (V_hi - V_lo) / (2.0 * h);
+
+        heurErr.update(V_ref, dV_ref, V, dV, dV_num, 1.0);
+    }
+    report("HeuresticDihedral::eval", heurErr);
+
+    ComplexNativeDihedral cnd;
+    auto scale = max(cnd.CDA, cnd.CDB);
+
+    Errors nativeErr;
+    for (int it = 0; it < numSamples; ++it) {
+        auto phi = angle(gen), phi0 = angle(gen);
+        auto cos_phi0 = cos(phi0), sin_phi0 = sin(phi0);
+
+        double V_ref = 0.0, dV_ref = 0.0, V = 0.0, dV = 0.0;
+        reference::complexNative(cnd.CDA, cnd.CDB, phi0, phi, V_ref, dV_ref);
+        cnd.eval(cos_phi0, sin_phi0, cos(phi), sin(phi), V, dV);
+
+        double V_lo = 0.0, V_hi = 0.0, dummy = 0.0;
+        cnd.eval(cos_phi0, sin_phi0, cos(phi - h), sin(phi - h), V_lo, dummy);
+        cnd.eval(cos_phi0, sin_phi0, cos(phi + h), sin(phi + h), V_hi, dummy);
+        auto dV_num = (V_hi - V_lo) / (2.0 * h);
+
+        nativeErr.update(V_ref, dV_ref, V, dV, dV_num, scale);
+    }
+    report("ComplexNativeDihedral::eval", nativeErr);
+
+    Setup setup;
+    auto phi0 = setup.nativePhi();
+    auto const& residues = setup.model.residues;
+    auto const& params = setup.params;
+
+    auto heurTerm = [&](int i, double phi, double& V, double& dV_dphi) {
+        AminoAcid acid2(int8_t(residues[i-1].type)),
+            acid3(int8_t(residues[i].type));
+        auto const& C = params.dihedralParams.at(pairType(acid2, acid3));
+        reference::heurestic(C.data(), phi, V, dV_dphi);
+    };
+    bool forcesOk = check<HeuresticDihedral>("DihedralAngles (heurestic)",
+        setup, heurTerm);
+
+    ComplexNativeDihedral complexPart;
+    auto complexTerm = [&](int i, double phi, double& V, double& dV_dphi) {
+        reference::complexNative(complexPart.CDA, complexPart.CDB, phi0[i],
+            phi, V, dV_dphi);
+    };
+    forcesOk = check<ComplexNativeDihedral>("DihedralAngles (complex "
+        "native)", setup, complexTerm) && forcesOk;
+
+    SimpleNativeDihedral simplePart;
+    auto simpleTerm = [&](int i, double phi, double& V, double& dV_dphi) {
+        reference::simpleNative(simplePart.CDH, phi0[i], phi, V, dV_dphi);
+    };
+    forcesOk = check<SimpleNativeDihedral>("DihedralAngles (simple native)",
+        setup, simpleTerm) && forcesOk;
+
+    return heurErr.ok() && nativeErr.ok() && forcesOk ? 0 : 1;
+}
@@ -34,7 +34,8 @@ int main() {
     simul.add<Random>(rand);
     simul.add<LangPredictorCorrector>(0.005 * tau);
 
-    simul.add<PositionDiff>("data/positions.txt", "posDiffs.out");
+    auto& posDiff = simul.add<PositionDiff>("data/positions.txt",
+        "posDiffs.out");
 
     simul.add<Tether>(true);
     simul.add<NativeBA>();
@@ -46,5 +47,6 @@ int main() {
     for (int i = 0; i < 100; ++i) {
     	simul.step();
     }
+    posDiff.reportDrift();
     return 0;
 }
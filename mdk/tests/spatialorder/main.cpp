@@ -0,0 +1,189 @@
+#include <mdk/simul/Simulation.hpp>
+#include <mdk/files/pdb/Parser.hpp>
+#include <mdk/files/param/LegacyParser.hpp>
+#include <mdk/system/LangPredictorCorrector.hpp>
+#include <mdk/forces/All.hpp>
+#include <mdk/hooks/PositionDiff.hpp>
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <iomanip>
+using namespace mdk;
+using namespace std;
+
+/**
+ * Storage order of the residues in a run: the original one, the spatial
+ * one (reestablished at every rebuild of the Verlet list), or a random one
+ * set before the initialization (and then kept).
+ */
+enum class Order { ORIGINAL, SPATIAL, RANDOM };
+
+struct Run {
+    string name;
+    Order order;
+    double temperature;
+    int numSteps;
+};
+
+/**
+ * Results of a run: the final model, and whether the index maps and the
+ * per-residue arrays kept by a permute hook stayed consistent.
+ */
+struct Result {
+    Model model;
+    bool mapsOk = true;
+    int numPermutes = 0;
+};
+
+/**
+ * Runs the simulation of 1UBQ (in the setup of the \p posDiff example) for
+ * \p run.numSteps steps. If \p refPath is given, the positions at every step
+ * are saved to it in the format of \p PositionDiff; if \p diffPath is given,
+ * they are compared by a \p PositionDiff hook with the ones in \p refPath.
+ */
+Result simulate(Run const& run, string const& refPath,
+    string const& diffPath) {
+
+    ifstream pdbFile(DATA_DIR "/1ubq.pdb");
+    auto atomic = pdb::Parser().read(pdbFile).asModel();
+    atomic.addContactsFromAtomOverlap();
+    auto model = atomic.coarsen();
+
+    ifstream paramFile(DATA_DIR "/parametersMJ96.txt");
+    auto params = param::LegacyParser().read(paramFile);
+
+    auto rand = Random(448);
+    model.legacyMorphIntoSAW(rand, false, 0, 4.56 * angstrom, true);
+    model.initVelocity(rand, 0.35 * eps_kB, false);
+
+    Simulation simul(model, params);
+    simul.add<Random>(rand);
+    simul.add<LangPredictorCorrector>(0.005 * tau).temperature =
+        run.temperature;
+    simul.add<Tether>(true);
+    simul.add<NativeBA>();
+    simul.add<ComplexNativeDihedral>();
+    simul.add<NativeContacts>();
+    simul.add<PauliExclusion>();
+    if (!diffPath.empty())
+        simul.add<PositionDiff>(refPath, diffPath);
+
+    auto& state = simul.var<State>();
+    simul.var<vl::List>().spatialOrder = run.order == Order::SPATIAL;
+
+    /* A per-residue array kept in the storage order by a permute hook; it
+     * holds the original indices, so it shall always equal origIdx. */
+    Result res;
+    Integers tags(state.n);
+    iota(tags.begin(), tags.end(), 0);
+    state.permuteHooks.emplace_back([&](Integers const& order) -> void {
+        reorder(tags, order);
+        ++res.numPermutes;
+    });
+
+    if (run.order == Order::RANDOM) {
+        Integers order(state.n);
+        iota(order.begin(), order.end(), 0);
+        shuffle(order.begin(), order.end(), mt19937(1234));
+        state.permute(order);
+    }
+
+    auto checkMaps = [&]() -> void {
+        for (int k = 0; k < state.n; ++k) {
+            res.mapsOk = res.mapsOk && tags[k] == state.origIdx[k] &&
+                state.sortedIdx[state.origIdx[k]] == k;
+        }
+    };
+
+    ofstream ref;
+    if (diffPath.empty()) ref.open(refPath);
+    ref << setprecision(17);
+    auto save = [&](int step_nr) -> void {
+        if (!ref.is_open()) return;
+        res.model = model;
+        state.exportTo(res.model);
+        ref << "STEP " << step_nr << '\n';
+        for (auto const& residue: res.model.residues) {
+            Vector r = residue.r / angstrom;
+            ref << r.x() << ' ' << r.y() << ' ' << r.z() << '\n';
+        }
+    };
+
+    simul.init();
+    save(0);
+    for (int step_nr = 1; step_nr <= run.numSteps; ++step_nr) {
+        simul.step();
+        save(step_nr);
+        checkMaps();
+    }
+
+    res.model = model;
+    state.exportTo(res.model);
+    return res;
+}
+
+/**
+ * Reads the largest diff over the steps from the output of \p PositionDiff.
+ */
+double maxDiff(string const& diffPath) {
+    ifstream diffs(diffPath);
+    string line;
+    double maxDiff = 0.0;
+    int numSteps = 0;
+    while (getline(diffs, line)) {
+        if (line.rfind("Step #", 0) != 0) continue;
+        auto pos = line.find("max");
+        maxDiff = max(maxDiff, stod(line.substr(pos + 3)));
+        ++numSteps;
+    }
+    return numSteps > 0 ? maxDiff : INFINITY;
+}
+
+/**
+ * Compares the runs with the residues stored in the spatial and in a random
+ * order with the run in the original order, at zero temperature and with
+ * the Langevin noise. The chain-based forces and the noise are evaluated in
+ * the original order, so the trajectories shall agree up to the rounding of
+ * the sums of the pairwise forces.
+ */
+int main() {
+    bool ok = true;
+    for (double temperature: { 0.0, 0.35 * eps_kB }) {
+        Run ref = { "original", Order::ORIGINAL, temperature, 1000 };
+        auto refPath = "spatialorder_ref.txt";
+        auto expected = simulate(ref, refPath, "");
+
+        for (auto order: { Order::SPATIAL, Order::RANDOM }) {
+            Run run = ref;
+            run.order = order;
+            run.name = order == Order::SPATIAL ? "spatial" : "random";
+            auto diffPath = "spatialorder_" + run.name + ".txt";
+            auto res = simulate(run, refPath, diffPath);
+
+            double finalDiff = 0.0;
+            for (int i = 0; i < expected.model.n; ++i) {
+                auto diff = (res.model.residues[i].r -
+                    expected.model.residues[i].r).norm() / angstrom;
+                finalDiff = max(finalDiff, diff);
+            }
+            auto stepDiff = maxDiff(diffPath);
+
+            bool runOk = res.mapsOk && res.numPermutes > 0 &&
+                stepDiff < 1.0e-6 && finalDiff < 1.0e-6;
+            ok = ok && runOk;
+
+            cout << "[" << run.name << ", T = " << temperature / eps_kB
+                 << "] " << (runOk ? "OK" : "MISMATCH") << '\n'
+                 << "  Permutations       = " << res.numPermutes << '\n'
+                 << "  Index maps         = "
+                 << (res.mapsOk ? "OK" : "MISMATCH") << '\n'
+                 << "  Max diff (steps)   = " << stepDiff << " A\n"
+                 << "  Max diff (final)   = " << finalDiff << " A\n";
+        }
+    }
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,150 @@
+#include <mdk/kernels/TabulatedKernel.hpp>
+#include <mdk/kernels/LennardJones.hpp>
+#include <mdk/kernels/ShiftedTruncatedLJ.hpp>
+#include <mdk/kernels/DebyeHueckel.hpp>
+#include <mdk/simul/Simulation.hpp>
+#include <mdk/files/pdb/Parser.hpp>
+#include <mdk/files/param/LegacyParser.hpp>
+#include <mdk/system/LangPredictorCorrector.hpp>
+#include <mdk/forces/es/ConstDH.hpp>
+#include <mdk/utils/Units.hpp>
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <random>
+#include <cmath>
+using namespace mdk;
+using namespace std;
+
+/**
+ * Compares a tabulated kernel with the direct evaluation of the wrapped one
+ * at random distances within the tabulated range: the error of the
+ * potential and of its derivative, relative to their largest magnitudes on
+ * the segment of the tables containing the distance (as in
+ * \p TabulatedKernel::maxError), must be within the requested bound, up to
+ * the sampling of the error at the construction, and the force must point
+ * in the same direction.
+ */
+template<typename Kernel>
+bool check(char const* name, Kernel const& kernel, double r_min,
+    double maxRelError) {
+
+    TabulatedKernel<Kernel> tab(kernel, r_min, maxRelError);
+
+    auto sMin = r_min * r_min, sMax = pow(kernel.cutoff(), 2.0);
+    auto segLen = (sMax - sMin) / tab.numSegments();
+
+    auto magnitudes = [&](double s, double& maxV, double& maxD) -> void {
+        int k = min((int)((s - sMin) / segLen), tab.numSegments() - 1);
+        maxV = maxD = 0.0;
+        for (int j = 0; j <= 8; ++j) {
+            double V = 0.0, D = 0.0;
+            kernel.computeV(sqrt(sMin + (k + j / 8.0) * segLen), V, D);
+            maxV = max(maxV, abs(V));
+            maxD = max(maxD, abs(D));
+        }
+    };
+
+    mt19937 gen(1234);
+    uniform_real_distribution<double> dist(r_min, kernel.cutoff());
+
+    double errV = 0.0, errD = 0.0;
+    bool sameDir = true;
+    for (int it = 0; it < 100'000; ++it) {
+        auto norm = dist(gen);
+
+        double V = 0.0, D = 0.0, V_tab = 0.0, D_tab = 0.0;
+        kernel.computeV(norm, V, D);
+        tab.computeV(norm, V_tab, D_tab);
+
+        double maxV, maxD;
+        magnitudes(norm * norm, maxV, maxD);
+        errV = max(errV, abs(V_tab - V) / maxV);
+        errD = max(errD, abs(D_tab - D) / maxD);
+
+        Vector unit = Vector::UnitX(), F1 = Vector::Zero(),
+            F2 = Vector::Zero(), F1_tab = Vector::Zero(),
+            F2_tab = Vector::Zero();
+        kernel.template computeF<Vector&, Vector&>(unit, norm, V, F1, F2);
+        tab.template computeF<Vector&, Vector&>(unit, norm, V_tab, F1_tab,
+            F2_tab);
+        if (abs(D) > 1.0e-3 * maxD)
+            sameDir = sameDir && F1.dot(F1_tab) > 0.0 && F2.dot(F2_tab) > 0.0;
+    }
+
+    bool ok = tab.maxError() <= maxRelError && errV <= 2.0 * maxRelError &&
+        errD <= 2.0 * maxRelError && sameDir;
+
+    cout << "[" << name << "] " << (ok ? "OK" : "MISMATCH") << '\n'
+         << "  Segments            = " << tab.numSegments() << '\n'
+         << "  Max error (tables)  = " << tab.maxError() << '\n'
+         << "  Max error (V)       = " << errV << '\n'
+         << "  Max error (dV/dr)   = " << errD << '\n';
+
+    return ok;
+}
+
+/**
+ * Computes the forces of \p ConstDH for 1UBQ (in the setup of the \p posDiff
+ * example) with and without the tables, and compares them; the differences
+ * are relative to the energy and to the largest force.
+ */
+bool checkConstDH() {
+    ifstream pdbFile(DATA_DIR "/1ubq.pdb");
+    auto model = pdb::Parser().read(pdbFile).asModel().coarsen();
+
+    ifstream paramFile(DATA_DIR "/parametersMJ96.txt");
+    auto params = param::LegacyParser().read(paramFile);
+
+    /* The legacy parser reads the polarizations as characters, so that none
+     * of the residues would be charged; the charged ones are thus set here.
+     */
+    for (auto& [acid, spec]: params.specificity) {
+        auto name = (std::string)acid;
+        if (name == "LYS" || name == "ARG")
+            spec.polarization = param::Polarization::POLAR_POS;
+        else if (name == "ASP" || name == "GLU")
+            spec.polarization = param::Polarization::POLAR_NEG;
+    }
+
+    auto compute = [&](bool tabulated) -> Dynamics {
+        Simulation simul(model, params);
+        simul.add<Random>(448);
+        simul.add<LangPredictorCorrector>(0.005 * tau);
+        simul.add<ConstDH>().tabulated = tabulated;
+        auto& state = simul.var<State>();
+        simul.init();
+        return state.dyn;
+    };
+
+    auto direct = compute(false), tabulated = compute(true);
+
+    double maxF = 0.0, errF = 0.0;
+    for (int i = 0; i < (int)direct.F.size(); ++i) {
+        maxF = max(maxF, direct.F[i].norm());
+        errF = max(errF, (tabulated.F[i] - direct.F[i]).norm());
+    }
+    auto errV = abs(tabulated.V - direct.V) / abs(direct.V);
+    errF /= maxF;
+
+    bool ok = errV < 1.0e-5 && errF < 1.0e-5;
+    cout << "[ConstDH (tabulated)] " << (ok ? "OK" : "MISMATCH") << '\n'
+         << "  V (direct)          = " << direct.V << '\n'
+         << "  Max error (V)       = " << errV << '\n'
+         << "  Max error (F)       = " << errF << '\n';
+
+    return ok;
+}
+
+int main() {
+    bool ok = true;
+    ok = check("LennardJones", LennardJones(5.0 * angstrom, 1.0 * eps),
+        4.0 * angstrom, 1.0e-6) && ok;
+    ok = check("ShiftedTruncatedLJ", ShiftedTruncatedLJ(4.0 * angstrom,
+        1.0 * eps), 3.0 * angstrom, 1.0e-6) && ok;
+    ok = check("DebyeHueckel", DebyeHueckel(1.0 * eps * angstrom,
+        10.0 * angstrom, false), 3.0 * angstrom, 1.0e-6) && ok;
+    ok = checkConstDH() && ok;
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,342 @@
+#include <mdk/simul/Simulation.hpp>
+#include <mdk/forces/NonlocalForce.hpp>
+#include <iostream>
+#include <chrono>
+using namespace mdk;
+using namespace std;
+using namespace std::chrono;
+
+/**
+ * A nonlocal force which does nothing but save the Verlet list whenever it
+ * gets reconstructed.
+ */
+class Probe: public NonlocalForce {
+public:
+    explicit Probe(vl::Spec const& probeSpec): probeSpec(probeSpec) {};
+
+    void bind(Simulation& simulation) override {
+        NonlocalForce::bind(simulation);
+        installIntoVL();
+    }
+
+    void vlUpdateHook() override {
+        pairs.clear();
+        vlPairs().forEach([&](int i1, int i2) -> void {
+            pairs.emplace_back(i1, i2);
+        });
+    }
+
+    Pairs pairs;
+
+protected:
+    vl::Spec spec() const override {
+        return probeSpec;
+    }
+
+private:
+    vl::Spec probeSpec;
+};
+
+/**
+ * Another probe; the simulation object stores the variables by type, so we
+ * need a distinct type to have a second probe.
+ */
+class ShortProbe: public Probe {
+public:
+    using Probe::Probe;
+};
+
+struct Setup {
+    string name;
+    int n;
+    int chainLen;
+    Vector box;
+    bool pbc[3];
+    double cutoff;
+
+    /**
+     * Number and radius of dense aggregates, into which half of the residues
+     * are placed; the rest are scattered over the box.
+     */
+    int numClusters = 0;
+    double clusterRadius = 0.0;
+};
+
+Model genModel(Setup const& setup, Random& rand) {
+    vector<Vector> centres(setup.numClusters);
+    for (auto& centre: centres) {
+        for (int dim = 0; dim < 3; ++dim) {
+            centre[dim] = rand.uniform(-0.5, 0.5) * setup.box[dim];
+        }
+    }
+
+    Model model;
+    for (int i = 0; i < setup.n; ++i) {
+        if (i % setup.chainLen == 0) model.addChain();
+        auto& res = model.addResidue(&model.chains.back());
+
+        /* We place the residues partly outside of the box, so as to check
+         * whether the positions get wrapped properly.
+         */
+        if (!centres.empty() && i % 2 == 0) {
+            auto const& centre = centres[(int)(rand.uniform() * centres.size())];
+            auto radius = setup.clusterRadius * cbrt(rand.uniform());
+            res.r = centre + radius * rand.sphere();
+        }
+        else {
+            for (int dim = 0; dim < 3; ++dim) {
+                res.r[dim] = rand.uniform(-0.75, 0.75) * setup.box[dim];
+            }
+        }
+        res.v = Vector::Zero();
+        res.mass = 1.0;
+        res.type = ResType(ResTypeIdx::GLY);
+    }
+
+    model.top.setCell(setup.box);
+    for (int dim = 0; dim < 3; ++dim) {
+        model.top.use[dim] = setup.pbc[dim];
+    }
+
+    return model;
+}
+
+/**
+ * Computes the Verlet list for two probes, with a cutoff of \p setup.cutoff
+ * and of half of it, so as to check the sublists for different specs.
+ */
+std::pair<Pairs, Pairs> computePairs(Model const& model, Setup const& setup,
+    vl::List::Algorithm algorithm, double& ms, double pad = 10.0 * angstrom) {
+
+    Simulation simul(model, param::Parameters());
+    auto& probe = simul.add<Probe>((vl::Spec) {
+        .cutoffSq = pow(setup.cutoff, 2.0),
+        .minBondSep = 3
+    });
+    auto& shortProbe = simul.add<ShortProbe>((vl::Spec) {
+        .cutoffSq = pow(0.5 * setup.cutoff, 2.0),
+        .minBondSep = 2
+    });
+
+    auto& vl = simul.var<vl::List>();
+    vl.algorithm = algorithm;
+    vl.pad = pad;
+
+    auto then = high_resolution_clock::now();
+    vl.check();
+    auto now = high_resolution_clock::now();
+    ms = duration_cast<microseconds>(now - then).count() / 1000.0;
+
+    return { probe.pairs, shortProbe.pairs };
+}
+
+/**
+ * Checks the incremental update: after a few residues are moved, the patched
+ * list shall be equal to the one built from scratch for the reference
+ * positions of the residues, i.e. the new positions of the residues which
+ * have moved by more than a quarter of the padding, and the old positions
+ * of the others.
+ */
+bool checkIncremental(Model const& model, Setup const& setup, Random& rand,
+    double& ms) {
+
+    Simulation simul(model, param::Parameters());
+    auto& probe = simul.add<Probe>((vl::Spec) {
+        .cutoffSq = pow(setup.cutoff, 2.0),
+        .minBondSep = 3
+    });
+
+    auto& vl = simul.var<vl::List>();
+    vl.algorithm = vl::List::Algorithm::CELL;
+    vl.incremental = true;
+    vl.check();
+
+    auto& state = simul.var<State>();
+    auto refs = model;
+    for (int i = 0; i < state.n; ++i) {
+        auto u = rand.uniform();
+        double shift;
+        if (u < 0.05) shift = 6.0 * angstrom;
+        else if (u < 0.1) shift = 3.0 * angstrom;
+        else shift = 0.5 * angstrom;
+
+        state.r[i] += shift * rand.sphere();
+        if (shift > 2.5 * angstrom) refs.residues[i].r = state.r[i];
+    }
+    state.t += 1.0;
+
+    auto then = high_resolution_clock::now();
+    vl.check();
+    auto now = high_resolution_clock::now();
+    ms = duration_cast<microseconds>(now - then).count() / 1000.0;
+
+    double fullMs;
+    auto expected = computePairs(refs, setup,
+        vl::List::Algorithm::ALL_PAIRS, fullMs);
+
+    return probe.pairs == expected.first;
+}
+
+/**
+ * Copies the current positions of the residues into a model.
+ */
+Model withPositions(Model model, State const& state) {
+    for (int i = 0; i < state.n; ++i) {
+        model.residues[i].r = state.r[i];
+    }
+    return model;
+}
+
+/**
+ * Checks the lists built in the background: once the residues move by
+ * a quarter of the padding, the next list is built from a snapshot of the
+ * positions, with the padding enlarged by \p backgroundExtraPad; it shall be
+ * equal to the one built from scratch for the snapshot. The padding and
+ * the algorithm are changed while the list is being built (as done by the
+ * autotuner), which shall not affect it.
+ */
+bool checkBackground(Model const& model, Setup const& setup, Random& rand) {
+    Simulation simul(model, param::Parameters());
+    auto& probe = simul.add<Probe>((vl::Spec) {
+        .cutoffSq = pow(setup.cutoff, 2.0),
+        .minBondSep = 3
+    });
+
+    auto& vl = simul.var<vl::List>();
+    vl.algorithm = vl::List::Algorithm::CELL;
+    vl.background = true;
+    auto pad = vl.pad, bgPad = vl.pad + vl.backgroundExtraPad;
+    vl.check();
+
+    /* The first residue moves by more than a quarter of the padding (which
+     * starts the background build), and then by over a half of it in total
+     * (which makes the list wait for it), but by less than a quarter of the
+     * enlarged padding since the snapshot; the others stay close.
+     */
+    auto& state = simul.var<State>();
+    auto move = [&](double shift) -> void {
+        for (int i = 1; i < state.n; ++i)
+            state.r[i] += 0.1 * pad * rand.sphere();
+        state.r[0] += shift * Vector::UnitX();
+        state.t += 1.0;
+    };
+
+    move(0.3 * pad);
+    vl.check();
+    auto snapshot = withPositions(model, state);
+    vl.pad = 0.3 * angstrom;
+    vl.algorithm = vl::List::Algorithm::ALL_PAIRS;
+
+    move(0.25 * pad);
+    vl.check();
+
+    double ms;
+    auto expected = computePairs(snapshot, setup,
+        vl::List::Algorithm::ALL_PAIRS, ms, bgPad);
+
+    return probe.pairs == expected.first;
+}
+
+/**
+ * Checks the pruned lists: after the residues move by a half of the pruning
+ * padding, the lists shall be pruned again, and be equal to the ones built
+ * from scratch for the current positions with the pruning padding.
+ */
+bool checkPruned(Model const& model, Setup const& setup, Random& rand) {
+    Simulation simul(model, param::Parameters());
+    auto& probe = simul.add<Probe>((vl::Spec) {
+        .cutoffSq = pow(setup.cutoff, 2.0),
+        .minBondSep = 3
+    });
+
+    auto& vl = simul.var<vl::List>();
+    vl.algorithm = vl::List::Algorithm::CELL;
+    vl.prune = true;
+    vl.check();
+
+    double ms;
+    auto initial = computePairs(model, setup,
+        vl::List::Algorithm::ALL_PAIRS, ms, vl.prunePad);
+    bool ok = probe.pairs == initial.first;
+
+    auto& state = simul.var<State>();
+    for (int i = 1; i < state.n; ++i)
+        state.r[i] += 0.1 * vl.prunePad * rand.sphere();
+    state.r[0] += 0.6 * vl.prunePad * Vector::UnitX();
+    state.t += 1.0;
+    vl.check();
+
+    auto moved = computePairs(withPositions(model, state), setup,
+        vl::List::Algorithm::ALL_PAIRS, ms, vl.prunePad);
+    return ok && probe.pairs == moved.first;
+}
+
+int main() {
+    auto rand = Random(448);
+
+    vector<Setup> setups = {
+        { "free, sparse", 2000, 50, Vector::Constant(400.0 * angstrom),
+          { false, false, false }, 8.0 * angstrom },
+        { "free, dense", 2000, 50, Vector::Constant(80.0 * angstrom),
+          { false, false, false }, 8.0 * angstrom },
+        { "pbc", 4000, 100, Vector::Constant(150.0 * angstrom),
+          { true, true, true }, 10.0 * angstrom },
+        { "pbc, 1 cell", 500, 25, Vector::Constant(30.0 * angstrom),
+          { true, true, true }, 10.0 * angstrom },
+        { "pbc, 2 cells", 1000, 25, Vector::Constant(45.0 * angstrom),
+          { true, true, true }, 10.0 * angstrom },
+        { "pbc, 3 cells", 1500, 25, Vector::Constant(60.0 * angstrom),
+          { true, true, true }, 10.0 * angstrom },
+        { "pbc, slab", 2000, 40, Vector(150.0, 150.0, 40.0) * angstrom,
+          { true, true, false }, 10.0 * angstrom },
+        { "pbc, mixed", 2000, 40, Vector(45.0, 200.0, 70.0) * angstrom,
+          { true, false, true }, 10.0 * angstrom },
+        { "free, aggregates", 4000, 50, Vector::Constant(2000.0 * angstrom),
+          { false, false, false }, 8.0 * angstrom, 4, 20.0 * angstrom },
+        { "pbc, aggregates", 4000, 50, Vector::Constant(1000.0 * angstrom),
+          { true, true, true }, 10.0 * angstrom, 3, 25.0 * angstrom },
+    };
+
+    bool ok = true;
+    for (auto const& setup: setups) {
+        auto model = genModel(setup, rand);
+
+        double allPairsMs, cellMs;
+        auto allPairs = computePairs(model, setup,
+            vl::List::Algorithm::ALL_PAIRS, allPairsMs);
+        auto cell = computePairs(model, setup,
+            vl::List::Algorithm::CELL, cellMs);
+
+        bool equal = allPairs == cell;
+        ok = ok && equal;
+
+        cout << "[" << setup.name << "] "
+             << (equal ? "OK" : "MISMATCH") << '\n'
+             << "  Pairs (all pairs) = " << allPairs.first.size()
+             << " + " << allPairs.second.size() << '\n'
+             << "  Pairs (cell)      = " << cell.first.size()
+             << " + " << cell.second.size() << '\n'
+             << "  Time (all pairs)  = " << allPairsMs << " ms\n"
+             << "  Time (cell)       = " << cellMs << " ms\n";
+
+        double incrementalMs;
+        bool incrementalOk = checkIncremental(model, setup, rand,
+            incrementalMs);
+        ok = ok && incrementalOk;
+
+        cout << "  Incremental       = "
+             << (incrementalOk ? "OK" : "MISMATCH") << '\n'
+             << "  Time (patch)      = " << incrementalMs << " ms\n";
+
+        bool backgroundOk = checkBackground(model, setup, rand);
+        bool prunedOk = checkPruned(model, setup, rand);
+        ok = ok && backgroundOk && prunedOk;
+
+        cout << "  Background        = "
+             << (backgroundOk ? "OK" : "MISMATCH") << '\n'
+             << "  Pruned            = "
+             << (prunedOk ? "OK" : "MISMATCH") << '\n';
+    }
+
+    return ok ? 0 : 1;
+}